@@ -0,0 +1,608 @@
+/*
+ * Copyright (c) 2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+/**
+
+Notices:
+
+Copyright 2016 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration. No
+copyright is claimed in the United States under Title 17,
+U.S. Code. All Other Rights Reserved.
+
+Disclaimers
+
+No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY
+WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY,
+INCLUDING, BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE
+WILL CONFORM TO SPECIFICATIONS, ANY IMPLIED WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR FREEDOM FROM
+INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER,
+CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT
+OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY
+OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.
+FURTHER, GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES
+REGARDING THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE,
+AND DISTRIBUTES IT "AS IS."
+
+Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS
+AGAINST THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND
+SUBCONTRACTORS, AS WELL AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF
+THE SUBJECT SOFTWARE RESULTS IN ANY LIABILITIES, DEMANDS, DAMAGES,
+EXPENSES OR LOSSES ARISING FROM SUCH USE, INCLUDING ANY DAMAGES FROM
+PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S USE OF THE SUBJECT
+SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE UNITED
+STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE
+REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL
+TERMINATION OF THIS AGREEMENT.
+ **/
+
+/*
+ * This application transforms a file iteratively produced by the method Daidalus::toString into 
+ * an encounter file (.daa) and a configuration file (.conf) that can be processed by DaidalusFileWalker.
+ * It accepts the same options as Scripts/daidalize.pl and produces the same output, where label columns
+ * are listed in the order given by the option --labels. In contrast to the script, the log is read in chunks and each chunk is split, at the beginning of Daidalus objects, into 
+ * segments that are parsed in parallel. Time checks, label values, and output are then processed 
+ * sequentially in log order, so memory usage is bounded by the chunk size regardless of the log size.
+ * 
+ * Optionally, the encounter is written in a binary format (.daab) with the following layout, where 
+ * strings are written as an int32 length followed by its characters, and numbers are in native byte order:
+ *   char[4] "DAAB", int32 version (1), int32 number of columns n, n strings (column names), 
+ *   n strings (column units), and for each aircraft state, int32 number of fields m followed by m fields,
+ *   where each field is either a char 'd' followed by a double or a char 's' followed by a string.
+ */
+
+#include "string_util.h"
+#include "WorkStealingExecutor.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <string>
+
+using namespace larcfm;
+
+/*
+ * Item produced by the parsing of a segment. If label is non-negative, the item sets the value of the
+ * label-th output label to text. Otherwise, the item is an aircraft state given by text (trimmed line), 
+ * whose time is t_str (t). The flag new_time_step is true if it's the first state printed after a header.
+ */
+struct Item {
+  int label;
+  std::string text;
+  std::string t_str;
+  double t;
+  bool new_time_step;
+};
+
+/*
+ * Parsing state of the log, following the variables of the Perl script
+ */
+struct LogState {
+  bool header;
+  int do_;
+  bool doconf;
+  bool new_time_step;
+  int nameidx;
+  int timeidx;
+  LogState() : header(false), do_(-1), doconf(false), new_time_step(true), nameidx(-1), timeidx(-1) {}
+};
+
+class Daidalize {
+
+public:
+  std::vector<std::string> onlyl;  // List of aircraft to be considered
+  std::vector<std::string> butl;   // List of aircraft to be excluded
+  std::vector<std::string> labels; // Labels given by the user
+  std::vector<std::string> collabs; // Labels, found before the header, that are added as columns 
+  std::vector<std::string> colval;  // Current value of labels 
+  std::vector<std::string> coluni;  // Units of labels
+  std::vector<bool> colset;         // True if label has been found
+  bool fixtimes;
+  bool binary;
+  int threads;  // Number of segments parsed in parallel
+  Executor* executor; // Executor that parses the segments
+
+  Daidalize() : fixtimes(false), binary(false), threads(1), executor(&Executor::defaultExecutor()), 
+      current_time_(-1), out_(NULL), conf_(NULL), timeidx_(-1) {}
+
+  bool run(std::istream& in, std::ostream& out, std::ostream& conf) {
+    out_ = &out;
+    conf_ = &conf;
+    colval.assign(labels.size(),"");
+    coluni.assign(labels.size(),"");
+    colset.assign(labels.size(),false);
+    LogState state;
+    std::string line;
+    // The header and the configuration of the first Daidalus object are processed sequentially
+    while (!state.header && std::getline(in,line)) {
+      process_header_line(state,line);
+    }
+    if (!state.header) {
+      return true;
+    }
+    const size_t chunk_size = ((size_t)1 << 22)*threads;
+    std::string buffer;
+    bool first = true;
+    while (in || !buffer.empty()) {
+      size_t prev = buffer.size();
+      if (in) {
+        buffer.resize(prev+chunk_size);
+        in.read(&buffer[prev],chunk_size);
+        buffer.resize(prev+in.gcount());
+      }
+      bool eof = !in;
+      // Segments end at the beginning of a Daidalus object. The last incomplete segment is carried 
+      // to the next chunk, unless the end of the file has been reached.
+      std::vector<size_t> cuts;
+      cuts.push_back(0);
+      size_t end = eof ? buffer.size() : last_boundary(buffer,prev);
+      if (end == 0) {
+        continue;
+      }
+      for (int k=1; k < threads; ++k) {
+        size_t pos = next_boundary(buffer,std::max(cuts.back(),end/threads*k),end);
+        if (pos < end && pos > cuts.back()) {
+          cuts.push_back(pos);
+        }
+      }
+      cuts.push_back(end);
+      int n = (int)cuts.size()-1;
+      std::vector<std::vector<Item> > items(n);
+      std::vector<LogState> states(n,state);
+      for (int k=0; k < n; ++k) {
+        if (k > 0 || !first) {
+          states[k].do_ = -1;
+        }
+      }
+      if (n == 1) {
+        parse_segment(buffer,cuts[0],cuts[1],states[0],items[0]);
+      } else {
+        executor->parallel_for(0,n,std::bind(&Daidalize::parse_segment_task,this,std::placeholders::_1,
+            std::cref(buffer),std::cref(cuts),std::ref(states),std::ref(items)));
+      }
+      for (int k=0; k < n; ++k) {
+        if (!write_items(items[k])) {
+          return false;
+        }
+      }
+      first = false;
+      buffer.erase(0,end);
+      if (eof) {
+        break;
+      }
+    }
+    return true;
+  }
+
+private:
+  double current_time_;
+  std::ostream* out_;
+  std::ostream* conf_;
+  std::vector<int> collab_idx_;
+  std::string header_;
+  int timeidx_;
+  std::vector<std::string> names_;
+  std::vector<std::string> units_;
+
+  static bool is_delim(char c) {
+    return c == ' ' || c == ',';
+  }
+
+  static std::string trim_line(const char* b, const char* e) {
+    while (b < e && (*b == ' ' || *b == '\t' || *b == '\r' || *b == '\n')) ++b;
+    while (e > b && (e[-1] == ' ' || e[-1] == '\t' || e[-1] == '\r' || e[-1] == '\n')) --e;
+    return std::string(b,e);
+  }
+
+  /*
+   * Return position of the beginning of the first line starting with "# Daidalus Object" in buffer[from,to),
+   * whose previous line is not a header. Return to, if there is none.
+   */
+  static size_t next_boundary(const std::string& buffer, size_t from, size_t to) {
+    static const std::string mark = "\n# Daidalus Object";
+    size_t pos = from > 0 ? from-1 : 0;
+    while ((pos = buffer.find(mark,pos)) != std::string::npos && pos+1 < to) {
+      size_t prev = pos > 0 ? buffer.rfind('\n',pos-1) : std::string::npos;
+      prev = prev == std::string::npos ? 0 : prev+1;
+      if (buffer.substr(prev,pos-prev).find("NAME") == std::string::npos) {
+        return pos+1;
+      }
+      ++pos;
+    }
+    return to;
+  }
+
+  // Return the last boundary in buffer, starting the search at from. Return 0 if there is none.
+  static size_t last_boundary(const std::string& buffer, size_t from) {
+    size_t last = 0;
+    size_t pos = next_boundary(buffer,from > 0 ? from : 1,buffer.size());
+    while (pos < buffer.size()) {
+      last = pos;
+      pos = next_boundary(buffer,pos+1,buffer.size());
+    }
+    return last;
+  }
+
+  /*
+   * If str is "label = value [unit]" for a user's label, update the value and unit of the label
+   * and return its index. Otherwise, return -1. 
+   */
+  int match_label(const std::string& str, std::string& val, std::string& unit) const {
+    for (int i=0; i < (int)labels.size(); ++i) {
+      const std::string& label = labels[i];
+      if (str.compare(0,label.size(),label) != 0) {
+        continue;
+      }
+      size_t p = str.find_first_not_of(" \t",label.size());
+      if (p == std::string::npos || str[p] != '=') {
+        continue;
+      }
+      p = str.find_first_not_of(" \t\r\n",p+1);
+      if (p == std::string::npos || str[p] == '#') {
+        continue;
+      }
+      val = str.substr(p,str.find('#',p)-p);
+      trim(val);
+      unit = "unitless";
+      size_t e = val.rfind(']');
+      if (e != std::string::npos && e >= 2) {
+        size_t b = val.rfind('[',e-2);
+        if (b != std::string::npos && b >= 1) {
+          unit = trimCopy(val.substr(b+1,e-b-1));
+          val = trimCopy(val.substr(0,b));
+        }
+      }
+      return i;
+    }
+    return -1;
+  }
+
+  void process_header_line(LogState& state, const std::string& line) {
+    std::string str = trimCopy(line);
+    std::string val, unit;
+    int i = match_label(str,val,unit);
+    if (i >= 0) {
+      colval[i] = val;
+      coluni[i] = unit;
+      colset[i] = true;
+    }
+    if (contains(str,"NAME") || state.do_ == 0) {
+      header_ += str;
+      if (state.do_ < 0) {
+        std::vector<std::string> columns = split(str," ,");
+        for (int idx=0; idx < (int)columns.size(); ++idx) {
+          if (contains(columns[idx],"NAME")) {
+            state.nameidx = idx;
+          } else if (contains(columns[idx],"time")) {
+            state.timeidx = idx;
+          }
+        }
+        collabs.clear();
+        collab_idx_.clear();
+        for (int j=0; j < (int)labels.size(); ++j) {
+          if (colset[j]) {
+            collabs.push_back(labels[j]);
+            collab_idx_.push_back(j);
+            header_ += " "+labels[j];
+          }
+        }
+        names_ = columns;
+        names_.insert(names_.end(),collabs.begin(),collabs.end());
+      } else {
+        std::vector<std::string> units = split(str," ,");
+        for (int j=0; j < (int)labels.size(); ++j) {
+          if (colset[j]) {
+            header_ += " ["+coluni[j]+"]";
+            units.push_back("["+coluni[j]+"]");
+          }
+        }
+        units_ = units;
+      }
+      header_ += "\n";
+      if (state.do_ == 0) {
+        state.header = true;
+        timeidx_ = state.timeidx;
+        if (binary) {
+          write_binary_header();
+        } else {
+          *out_ << header_;
+        }
+      }
+      state.do_++;
+    } else if (contains(line,"Daidalus Object")) {
+      state.doconf = true;
+    } else if (contains(line,"###")) {
+      state.doconf = false;
+    } else if (state.doconf) {
+      *conf_ << str << std::endl;
+    }
+  }
+
+  /*
+   * Put in field the idx-th field of str, where fields are separated by spaces and commas. 
+   * Return false if there is no such field.
+   */
+  static bool field(const std::string& str, int idx, std::string& fld) {
+    size_t i = 0;
+    size_t n = str.size();
+    for (int k=0; ; ++k) {
+      while (i < n && is_delim(str[i])) ++i;
+      if (i >= n) {
+        return false;
+      }
+      size_t j = i;
+      while (j < n && !is_delim(str[j])) ++j;
+      if (k == idx) {
+        fld = str.substr(i,j-i);
+        return true;
+      }
+      i = j;
+    }
+  }
+
+  // Perl's grep(/name/,list)
+  static bool matches_any(const std::vector<std::string>& list, const std::string& name) {
+    for (int i=0; i < (int)list.size(); ++i) {
+      if (contains(list[i],name)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Parse the k-th segment of buffer, as delimited by cuts
+  void parse_segment_task(int k, const std::string& buffer, const std::vector<size_t>& cuts,
+      std::vector<LogState>& states, std::vector<std::vector<Item> >& items) const {
+    parse_segment(buffer,cuts[k],cuts[k+1],states[k],items[k]);
+  }
+
+  /*
+   * Parse buffer[from,to), which starts at the beginning of a line, and put in items the label updates 
+   * and aircraft states found in that segment. This method is executed in parallel for different segments.
+   */
+  void parse_segment(const std::string& buffer, size_t from, size_t to, LogState& state, std::vector<Item>& items) const {
+    const char* data = buffer.data();
+    std::string name;
+    std::string val, unit;
+    size_t pos = from;
+    while (pos < to) {
+      const char* b = data+pos;
+      const char* nl = (const char*)memchr(b,'\n',to-pos);
+      const char* e = nl ? nl : data+to;
+      pos = (e-data)+1;
+      std::string str = trim_line(b,e);
+      if (!labels.empty()) {
+        int i = match_label(str,val,unit);
+        if (i >= 0) {
+          Item item;
+          item.label = i;
+          item.text = val;
+          items.push_back(item);
+        }
+      }
+      if (contains(str,"NAME") || state.do_ == 0) {
+        state.do_++;
+        if (contains(str,"NAME")) {
+          state.new_time_step = true;
+        }
+      } else if (str.empty()) {
+        state.do_ = -1;
+      } else if (state.do_ > 0) {
+        Item item;
+        if (state.nameidx < 0 || state.timeidx < 0 ||
+            !field(str,state.nameidx,name) || !field(str,state.timeidx,item.t_str)) {
+          state.do_ = -1;
+          continue;
+        }
+        if ((!butl.empty() && matches_any(butl,name)) || (!onlyl.empty() && !matches_any(onlyl,name))) {
+          continue;
+        }
+        item.label = -1;
+        item.t = std::strtod(item.t_str.c_str(),NULL);
+        item.new_time_step = state.new_time_step;
+        item.text = str;
+        items.push_back(item);
+        state.new_time_step = false;
+      } 
+    }
+  }
+
+  // Perl's conversion of numbers to strings 
+  static std::string num2str(double d) {
+    char buf[32];
+    snprintf(buf,sizeof(buf),"%.15g",d);
+    return buf;
+  }
+
+  std::string fix_time(const std::string& str, int timeidx, double t) const {
+    std::vector<std::string> columns = split(str," ,");
+    columns[timeidx] = num2str(t);
+    std::string s = columns[0];
+    for (int i=1; i < (int)columns.size(); ++i) {
+      s += ", "+columns[i];
+    }
+    return s;
+  }
+
+  bool write_items(std::vector<Item>& items) {
+    std::string s;
+    for (int k=0; k < (int)items.size(); ++k) {
+      Item& item = items[k];
+      if (item.label >= 0) {
+        colval[item.label] = item.text;
+        continue;
+      }
+      double t = item.t;
+      bool fixed = false;
+      if (current_time_ == t) {
+        if (item.new_time_step) {
+          if (fixtimes) {
+            current_time_++;
+            fixed = true;
+          } else {
+            std::cerr << "** Error: Time " << item.t_str << " is the same a previous time. Try --fixtimes" << std::endl;
+            return false;
+          }
+        }
+      } else {
+        if (!item.new_time_step) {
+          if (fixtimes) {
+            fixed = true;
+          } else {
+            std::cerr << "** Error: Time " << item.t_str << " is different from current time" << std::endl;
+            return false;
+          }
+        } else if (t < current_time_) {
+          if (fixtimes) {
+            current_time_++;
+            fixed = true;
+          } else {
+            std::cerr << "** Warning: Time " << item.t_str << " is less than previous time" << std::endl;
+            return false;
+          }
+        } else {
+          current_time_ = t;
+        }
+      }
+      if (fixed) {
+        item.text = fix_time(item.text,timeidx_,current_time_);
+        std::cout << "** Warning: " << item.t_str << " --> " << num2str(current_time_) << std::endl;
+      }
+      if (binary) {
+        write_binary_state(s,item.text);
+      } else {
+        s += item.text;
+        for (int i=0; i < (int)collab_idx_.size(); ++i) {
+          s += ", "+colval[collab_idx_[i]];
+        }
+        s += "\n";
+      }
+    }
+    out_->write(s.data(),s.size());
+    return !out_->fail();
+  }
+
+  /**** Binary output ****/
+
+  static void put_int(std::string& s, int i) {
+    s.append((const char*)&i,sizeof(int));
+  }
+
+  static void put_string(std::string& s, const std::string& str) {
+    put_int(s,(int)str.size());
+    s += str;
+  }
+
+  void write_binary_header() {
+    std::string s = "DAAB";
+    put_int(s,1);
+    put_int(s,(int)names_.size());
+    for (int i=0; i < (int)names_.size(); ++i) {
+      put_string(s,names_[i]);
+    }
+    for (int i=0; i < (int)names_.size(); ++i) {
+      put_string(s,i < (int)units_.size() ? units_[i] : "[unitless]");
+    }
+    out_->write(s.data(),s.size());
+  }
+
+  void write_binary_state(std::string& s, const std::string& str) const {
+    std::vector<std::string> fields = split(str," ,");
+    for (int i=0; i < (int)collab_idx_.size(); ++i) {
+      fields.push_back(colval[collab_idx_[i]]);
+    }
+    put_int(s,(int)fields.size());
+    for (int i=0; i < (int)fields.size(); ++i) {
+      const char* c = fields[i].c_str();
+      char* end = NULL;
+      double d = std::strtod(c,&end);
+      if (!fields[i].empty() && *end == '\0') {
+        s += 'd';
+        s.append((const char*)&d,sizeof(double));
+      } else {
+        s += 's';
+        put_string(s,fields[i]);
+      }
+    }
+  }
+};
+
+int main(int argc, char* argv[]) {
+  Daidalize daidalize;
+  std::string infile = "";
+  std::string out = "";
+  daidalize.threads = Executor::defaultExecutor().concurrency();
+  std::unique_ptr<Executor> pool;
+  for (int a=1; a < argc; ++a) {
+    std::string arga = argv[a];
+    if ((startsWith(arga,"--only") || startsWith(arga,"-only")) && a+1 < argc) {
+      daidalize.onlyl = split(argv[++a],",");
+    } else if ((startsWith(arga,"--but") || startsWith(arga,"-but")) && a+1 < argc) {
+      daidalize.butl = split(argv[++a],",");
+    } else if ((startsWith(arga,"--lab") || startsWith(arga,"-lab")) && a+1 < argc) {
+      daidalize.labels = split(argv[++a],",");
+    } else if ((startsWith(arga,"--o") || startsWith(arga,"-o")) && a+1 < argc) {
+      out = argv[++a];
+    } else if (startsWith(arga,"--fix") || startsWith(arga,"-fix")) {
+      daidalize.fixtimes = true;
+    } else if (startsWith(arga,"--bin") || startsWith(arga,"-bin")) {
+      daidalize.binary = true;
+    } else if ((startsWith(arga,"--thr") || startsWith(arga,"-thr")) && a+1 < argc) {
+      std::istringstream(argv[++a]) >> daidalize.threads;
+      daidalize.threads = std::max(1,daidalize.threads);
+      pool.reset(new WorkStealingExecutor(daidalize.threads));
+      daidalize.executor = pool.get();
+    } else if (startsWith(arga,"-")) {
+      infile = "";
+      break;
+    } else {
+      infile = arga;
+    }
+  }
+  if (infile == "") {
+    std::cerr << "Transforms a file iteratively produced by the method Daidalus::toString into a file that can be processed by the DaidalusFileWalker class." << std::endl;
+    std::cerr << "Usage: Daidalize [--only <ac1>,..,<acn>] [--but <ac1>,..,<acn>] [--labels <lab1>,..,<labn>] [--out <filename>] [--fixtimes] [--binary] [--threads <n>] <file>" << std::endl;
+    exit(1);
+  }
+  std::ifstream in(infile.c_str(),std::ios::in | std::ios::binary);
+  if (!in) {
+    std::cerr << "** Error: Cannot open file " << infile << std::endl;
+    exit(1);
+  }
+  if (out == "") {
+    std::string base_filename = infile.substr(infile.find_last_of("/\\") + 1);
+    out = base_filename.substr(0,base_filename.find('.'));
+  }
+  std::string outfile = out+(daidalize.binary ? ".daab" : ".daa");
+  std::string confile = out+".conf";
+  std::cout << "Processing " << infile << std::endl;
+  std::cout << "Writing traffic file: " << outfile << std::endl;
+  std::cout << "Writing configuration file: " << confile << std::endl;
+  std::ofstream outf(outfile.c_str(),std::ios::out | std::ios::binary);
+  if (!outf) {
+    std::cerr << "** Error: Cannot save file " << outfile << std::endl;
+    exit(1);
+  }
+  std::ofstream conff(confile.c_str());
+  if (!conff) {
+    std::cerr << "** Error: Cannot save file " << confile << std::endl;
+    exit(1);
+  }
+  bool ok = daidalize.run(in,outf,conff);
+  outf.close();
+  conff.close();
+  return ok ? 0 : 1;
+}
@@ -46,6 +46,7 @@ TERMINATION OF THIS AGREEMENT.
 #include "Daidalus.h"
 #include "WCV_tvar.h"
 #include "DaidalusFileWalker.h"
+#include "ShadowChecker.h"
 
 using namespace larcfm;
 
@@ -66,6 +67,7 @@ int main(int argc, char* argv[]) {
   int precision = 6;
 	bool do_inst = false;
 	bool no_hyst = false;
+  double shadow_rate = 0.0;
 
   for (int a=1;a < argc; ++a) {
     std::string arga = argv[a];
@@ -129,6 +131,9 @@ int main(int argc, char* argv[]) {
 		} else if (startsWith(arga,"--nohys") || startsWith(arga,"-nohys")) {
 			// Use the given configuration, but disable hysteresis
 			no_hyst = true;
+		} else if ((startsWith(arga,"--shadow") || startsWith(arga,"-shadow")) && a+1 < argc) {
+      ++a;
+      std::istringstream(argv[a]) >> shadow_rate;
 		} else if (startsWith(arga,"--h") || startsWith(arga,"-h")) {
       std::cerr << "Usage:" << std::endl;
       std::cerr << "  DaidalusAlerting [<option>] <daa_file>" << std::endl;
@@ -142,6 +147,7 @@ int main(int argc, char* argv[]) {
       std::cerr << "  --traffic <id1>,..,<idn>\n\tSpecify a list of aircraft as traffic" << std::endl;
       std::cerr << "  --instantaneous\n\tOverride configuration to do instantaneous bands" << std::endl;
 			std::cerr << "  --nohystereis\n\tOverride configuation to disable hysteresis" << std::endl;
+      std::cerr << "  --shadow <rate>\n\tCheck a fraction <rate> of the time steps against the reference computation path" << std::endl;
       std::cerr << "  --help\n\tPrint this message" << std::endl;
       exit(0);
     } else if (startsWith(arga,"-")){
@@ -239,8 +245,12 @@ int main(int argc, char* argv[]) {
   out << std::endl;
   out << line_units << std::endl;
 
+  ShadowChecker shadow(shadow_rate);
   while (!walker.atEnd()) {
     walker.readState(daa);
+    if (shadow_rate > 0) {
+      shadow.check(daa);
+    }
     if (echo) {
       std::cout << daa.toString();
     }
@@ -270,29 +280,30 @@ int main(int argc, char* argv[]) {
           out << ", " << FmPrecision(Units::to("nmi",dh));
         }
       }
+      // All metrics of this aircraft are computed in one pass
+      const EncounterMetrics& metrics = daa.encounterMetrics(ac);
       for (int level=1; level <= max_alert_levels; ++level) {
         out << ", ";
         if (level <= alerter.mostSevereAlertLevel()) {
-          ConflictData det = daa.violationOfAlertThresholds(ac,level);
-          out << FmPrecision(det.getTimeIn());
+          out << FmPrecision(metrics.timeToVolume(level));
         }
       }
-      out << ", " << FmPrecision(daa.currentHorizontalSeparation(ac,uhor));
-      out << ", " << FmPrecision(daa.currentVerticalSeparation(ac,uver));
-      out << ", " << FmPrecision(daa.horizontalClosureRate(ac,uhs));
-      out << ", " << FmPrecision(daa.verticalClosureRate(ac,uvs));
-      out << ", " << FmPrecision(daa.predictedHorizontalMissDistance(ac,uhor));
-      out << ", " << FmPrecision(daa.predictedVerticalMissDistance(ac,uver));
-      out << ", " << FmPrecision(daa.timeToHorizontalClosestPointOfApproach(ac));
-      out << ", " << FmPrecision(daa.distanceAtHorizontalClosestPointOfApproach(ac,uhor));
-      double tcoa = daa.timeToCoAltitude(ac);
+      out << ", " << FmPrecision(Units::to(uhor,metrics.horizontal_separation));
+      out << ", " << FmPrecision(Units::to(uver,metrics.vertical_separation));
+      out << ", " << FmPrecision(Units::to(uhs,metrics.horizontal_closure_rate));
+      out << ", " << FmPrecision(Units::to(uvs,metrics.vertical_closure_rate));
+      out << ", " << FmPrecision(Units::to(uhor,metrics.hmd));
+      out << ", " << FmPrecision(Units::to(uver,metrics.vmd));
+      out << ", " << FmPrecision(metrics.tcpa);
+      out << ", " << FmPrecision(Units::to(uhor,metrics.dcpa));
+      double tcoa = metrics.tcoa;
       out << ", ";
       if (tcoa >= 0) {
         out << FmPrecision(tcoa);
       }
       out << ", ";
       if (detector.isValid() && detector.getSimpleSuperClassName() == "WCV_tvar") {
-        double tau_mod  = daa.modifiedTau(ac,((WCV_tvar&)detector).getDTHR());
+        double tau_mod  = metrics.modifiedTau(((WCV_tvar&)detector).getDTHR());
         if (tau_mod >= 0) {
           out << FmPrecision(tau_mod);
         }
@@ -301,4 +312,7 @@ int main(int argc, char* argv[]) {
     }
   }
   out.close();
+  if (shadow_rate > 0) {
+    std::cerr << shadow.toString();
+  }
 }
@@ -46,6 +46,7 @@ public:
 		std::cout << "  --precision <n>\n\tOutput decimal precision" << std::endl;
 	    std::cerr << "  --instantaneous\n\tOverride configuration to do instantaneous bands" << std::endl;
 		std::cerr << "  --nohystereis\n\tOverride configuation to disable hysteresis" << std::endl;		
+		std::cout << "  --recovery_threads <n>\n\tEvaluate up to <n> recovery cylinder sizes concurrently" << std::endl;
 		std::cout << getHelpString() << std::endl;
 		exit(0);
 	}
@@ -84,13 +85,13 @@ public:
 	void printOutput(Daidalus& daa) {
 		switch (format) {
 		case STANDARD:
-			(*out) << daa.outputString();
+			daa.outputString(*out);
 			if (raw) {
 				(*out) << daa.rawString();
 			}
 			break;
 		case PVS:
-			(*out) << daa.toPVS(false);
+			daa.toPVS(*out,false);
 			break;
 		}
 	}
@@ -115,6 +116,7 @@ int main(int argc, const char* argv[]) {
 	int precision = 6;
 	bool do_inst = false;
 	bool no_hyst = false;
+	int recovery_threads = 1;
 	for (a=1;a < argc && argv[a][0]=='-'; ++a) {
 		std::string arga = argv[a];
 		options += arga + " ";
@@ -145,6 +147,10 @@ int main(int argc, const char* argv[]) {
 		} else if (startsWith(arga,"--nohys") || startsWith(arga,"-nohys")) {
 			// Use the given configuration, but disable hysteresis
 			no_hyst = true;
+		} else if (startsWith(arga,"--recovery_threads") || startsWith(arga,"-recovery_threads")) {
+			++a;
+			std::istringstream(argv[a]) >> recovery_threads;
+			options += std::string(argv[a])+" ";
 		} else if (startsWith(arga,"-") && arga.find('=') != std::string::npos) {
 			std::string keyval = arga.substr(arga.find_last_of('-')+1);
 			params.set(keyval);
@@ -201,6 +207,7 @@ int main(int argc, const char* argv[]) {
   	if (no_hyst) {
     	daa.disableHysteresis();
   	}
+	daa.setRecoveryThreads(recovery_threads);
 	switch (walker.format) {
 	case STANDARD:
 		if (walker.verbose) {
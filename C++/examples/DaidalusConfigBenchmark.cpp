@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+/**
+
+Notices:
+
+Copyright 2016 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration. No
+copyright is claimed in the United States under Title 17,
+U.S. Code. All Other Rights Reserved.
+
+Disclaimers
+
+No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY
+WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY,
+INCLUDING, BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE
+WILL CONFORM TO SPECIFICATIONS, ANY IMPLIED WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR FREEDOM FROM
+INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER,
+CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT
+OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY
+OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.
+FURTHER, GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES
+REGARDING THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE,
+AND DISTRIBUTES IT "AS IS."
+
+Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS
+AGAINST THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND
+SUBCONTRACTORS, AS WELL AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF
+THE SUBJECT SOFTWARE RESULTS IN ANY LIABILITIES, DEMANDS, DAMAGES,
+EXPENSES OR LOSSES ARISING FROM SUCH USE, INCLUDING ANY DAMAGES FROM
+PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S USE OF THE SUBJECT
+SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE UNITED
+STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE
+REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL
+TERMINATION OF THIS AGREEMENT.
+ **/
+
+/*
+ * This application measures the time needed to instantiate Daidalus objects from configurations, i.e., 
+ * loading a configuration file, setting parameters from a ParameterData object, and copying a
+ * configured object. Configurations are given as files or as one of the predefined configurations.
+ * It also reports the estimated memory footprint, in bytes, of an instance per configuration: once configured,
+ * and by component after computing all bands and alerts of a synthetic encounter, where traffic aircraft 
+ * converge on the ownship, and after trimming memory once traffic aircraft are gone.
+ */
+
+#include "Daidalus.h"
+#include <iostream>
+#include <sstream>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+#include <cmath>
+
+using namespace larcfm;
+
+static bool configure(Daidalus& daa, const std::string& conf) {
+  if (daa.loadFromFile(conf)) {
+    return true;
+  } else if (conf == "sum") {
+    daa.set_DO_365B(true,true);
+  } else if (conf == "no_sum") {
+    daa.set_DO_365B(true,false);
+  } else if (conf == "nom_a") {
+    daa.set_Buffered_WC_DO_365(false);
+  } else if (conf == "nom_b") {
+    daa.set_Buffered_WC_DO_365(true);
+  } else if (conf == "cd3d") {
+    daa.set_CD3D();
+  } else if (conf == "tcasii") {
+    daa.set_TCASII();
+  } else {
+    return false;
+  }
+  return true;
+}
+
+/*
+ * Compute all bands and alerts for the given number of time steps of an encounter where traffic aircraft,
+ * evenly distributed on a circle of 5 nmi, converge on the ownship
+ */
+static void encounter(Daidalus& daa, int traffic, int steps) {
+  Position so = Position::makeXYZ(0.0,"nmi",0.0,"nmi",10000.0,"ft");
+  Velocity vo = Velocity::makeTrkGsVs(0.0,"deg",200.0,"kn",0.0,"fpm");
+  for (int t=0; t < steps; ++t) {
+    daa.setOwnshipState("ownship",so.linear(vo,t),vo,t);
+    for (int i=0; i < traffic; ++i) {
+      double angle = 360.0*i/traffic;
+      Position si = Position::makeXYZ(5.0*std::sin(Units::from("deg",angle)),"nmi",
+          5.0*std::cos(Units::from("deg",angle)),"nmi",10000.0,"ft");
+      Velocity vi = Velocity::makeTrkGsVs(angle+180.0,"deg",150.0,"kn",0.0,"fpm");
+      daa.addTrafficState("AC"+Fmi(i+1),si.linear(vi,t),vi);
+    }
+    DaidalusResult result(daa);
+  }
+}
+
+// Return average time in microseconds since start over n repetitions
+static double usecs(const std::chrono::steady_clock::time_point& start, int n) {
+  return std::chrono::duration<double,std::micro>(std::chrono::steady_clock::now()-start).count()/n;
+}
+
+int main(int argc, char* argv[]) {
+  int n = 100;
+  int traffic = 10;
+  int steps = 10;
+  std::vector<std::string> confs;
+  for (int a=1; a < argc; ++a) {
+    std::string arga = argv[a];
+    if ((startsWith(arga,"--n") || startsWith(arga,"-n")) && a+1 < argc) {
+      std::istringstream(argv[++a]) >> n;
+    } else if ((startsWith(arga,"--t") || startsWith(arga,"-t")) && a+1 < argc) {
+      std::istringstream(argv[++a]) >> traffic;
+    } else if ((startsWith(arga,"--s") || startsWith(arga,"-s")) && a+1 < argc) {
+      std::istringstream(argv[++a]) >> steps;
+    } else if (startsWith(arga,"--h") || startsWith(arga,"-h")) {
+      std::cerr << "Usage:" << std::endl;
+      std::cerr << "  DaidalusConfigBenchmark [--n <repetitions>] [--traffic <aircraft>] [--steps <time steps>] <configuration-file> | sum | no_sum | nom_a | nom_b | cd3d | tcasii ..." << std::endl;
+      exit(0);
+    } else {
+      confs.push_back(arga);
+    }
+  }
+  if (confs.empty()) {
+    confs.push_back("sum");
+  }
+  n = std::max(1,n);
+  traffic = std::max(0,traffic);
+  steps = std::max(1,steps);
+  std::cout << "Average time in microseconds over " << n << " repetitions" << std::endl;
+  std::cout << "configuration, load, setParameterData, copy" << std::endl;
+  for (int k=0; k < (int)confs.size(); ++k) {
+    Daidalus daa;
+    if (!configure(daa,confs[k])) {
+      std::cerr << "** Error: Configuration " << confs[k] << " not found" << std::endl;
+      continue;
+    }
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i=0; i < n; ++i) {
+      Daidalus d;
+      configure(d,confs[k]);
+    }
+    double load = usecs(start,n);
+    ParameterData p = daa.getParameterData();
+    start = std::chrono::steady_clock::now();
+    for (int i=0; i < n; ++i) {
+      Daidalus d;
+      d.setParameterData(p);
+    }
+    double set = usecs(start,n);
+    start = std::chrono::steady_clock::now();
+    for (int i=0; i < n; ++i) {
+      Daidalus d(daa);
+    }
+    double copy = usecs(start,n);
+    std::cout << confs[k] << ", " << FmPrecision(load,1) << ", " << FmPrecision(set,1) << ", " << FmPrecision(copy,1) << std::endl;
+  }
+  std::cout << std::endl;
+  std::cout << "Estimated bytes per instance, encounter of " << traffic << " traffic aircraft and " << steps << " time steps" << std::endl;
+  std::cout << "configuration, configured, parameters, traffic, alerting_hysteresis, bands_hysteresis, " <<
+      "core_caches, bands_caches, encounter, trimmed" << std::endl;
+  for (int k=0; k < (int)confs.size(); ++k) {
+    Daidalus daa;
+    if (!configure(daa,confs[k])) {
+      continue;
+    }
+    int configured = daa.memoryUsage().total();
+    encounter(daa,traffic,steps);
+    MemoryUsage usage = daa.memoryUsage();
+    // Traffic aircraft are gone in the next time step
+    daa.setOwnshipState("ownship",Position::makeXYZ(0.0,"nmi",0.0,"nmi",10000.0,"ft"),Velocity::ZERO(),steps);
+    daa.trimMemory();
+    std::cout << confs[k] << ", " << configured << ", " << usage.parameters << ", " << usage.traffic << ", " <<
+        usage.alerting_hysteresis << ", " << usage.bands_hysteresis << ", " << usage.core_caches << ", " <<
+        usage.bands_caches << ", " << usage.total() << ", " << daa.memoryUsage().total() << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+/**
+
+Notices:
+
+Copyright 2016 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration. No
+copyright is claimed in the United States under Title 17,
+U.S. Code. All Other Rights Reserved.
+
+Disclaimers
+
+No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY
+WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY,
+INCLUDING, BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE
+WILL CONFORM TO SPECIFICATIONS, ANY IMPLIED WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR FREEDOM FROM
+INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER,
+CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT
+OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY
+OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.
+FURTHER, GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES
+REGARDING THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE,
+AND DISTRIBUTES IT "AS IS."
+
+Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS
+AGAINST THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND
+SUBCONTRACTORS, AS WELL AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF
+THE SUBJECT SOFTWARE RESULTS IN ANY LIABILITIES, DEMANDS, DAMAGES,
+EXPENSES OR LOSSES ARISING FROM SUCH USE, INCLUDING ANY DAMAGES FROM
+PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S USE OF THE SUBJECT
+SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE UNITED
+STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE
+REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL
+TERMINATION OF THIS AGREEMENT.
+ **/
+
+/*
+ * This application computes multi-level bands in all dimensions (direction, horizontal speed, vertical speed,
+ * and altitude) for every time step of an encounter file. It writes a text file (.draw) that can be processed 
+ * with the Python script drawmultibands.py, i.e., the same file produced by the Java application DrawMultiBands, 
+ * and a columnar file (.mbands) with the bands, resolutions, and recovery information of every time step. 
+ * When hysteresis is disabled, e.g., --nohys, time steps are independent of each other and the encounter is 
+ * split into chunks of consecutive time steps that are processed in parallel.
+ *
+ * The columnar file starts with char[4] "DAMB", int32 version (1), int32 number of time steps, and int32 number 
+ * of columns. Each column is given by its name, its units, a char type ('d': double, 'i': int32, 'b': int8), 
+ * an int32 number of elements, and the elements, where strings are written as an int32 length followed by its 
+ * characters, and numbers are in native byte order. Per-step columns have one element per time step. For each 
+ * dimension <dim> (trk, gs, vs, alt), the bands of all time steps are flattened in the columns <dim>_low, 
+ * <dim>_up, <dim>_region, where <dim>_count has the number of bands per time step. Regions are encoded as in 
+ * the text file, i.e., NONE=0, FAR=1, MID=2, NEAR=3, RECOVERY=4, and -1 otherwise.
+ */
+
+#include "Daidalus.h"
+#include "DaidalusFileWalker.h"
+#include "WorkStealingExecutor.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <map>
+
+using namespace larcfm;
+
+static const int NUMBER_OF_DIMENSIONS = 4;
+static const char* dim_names[NUMBER_OF_DIMENSIONS] = {"trk","gs","vs","alt"};
+static const char* draw_names[NUMBER_OF_DIMENSIONS] = {"TrkBands","GsBands","VsBands","AltBands"};
+
+/*
+ * Bands in one dimension at a given time step
+ */
+class DimensionBands {
+public:
+  std::vector<Interval> intervals;
+  std::vector<int> regions;
+  double resolution_low;
+  double resolution_up;
+  bool preferred;
+  RecoveryInformation recovery;
+
+  DimensionBands() : resolution_low(NaN), resolution_up(NaN), preferred(false), recovery(NaN,0,NaN,NaN) {}
+};
+
+/*
+ * Information computed at a given time step
+ */
+class TimeStep {
+public:
+  double time;
+  std::string ownship;
+  double trko;
+  double gso;
+  double vso;
+  double alto;
+  DimensionBands bands[NUMBER_OF_DIMENSIONS];
+  std::vector<std::pair<std::string,int> > alerts;
+  int most_severe_alert_level;
+
+  TimeStep() : time(NaN), trko(NaN), gso(NaN), vso(NaN), alto(NaN), most_severe_alert_level(0) {}
+};
+
+static int region2int(BandsRegion::Region r) {
+  switch (r) {
+  case BandsRegion::NONE: return 0;
+  case BandsRegion::FAR: return 1;
+  case BandsRegion::MID: return 2;
+  case BandsRegion::NEAR: return 3;
+  case BandsRegion::RECOVERY: return 4;
+  default: return -1;
+  }
+}
+
+static bool hysteresis_disabled(const Daidalus& daa) {
+  return daa.getHysteresisTime() == 0.0 && daa.getPersistenceTime() == 0.0 && 
+      !daa.isEnabledBandsPersistence() && daa.getAlertingParameterM() <= 1 && 
+      daa.getPersistencePreferredHorizontalDirectionResolution() == 0.0 &&
+      daa.getPersistencePreferredHorizontalSpeedResolution() == 0.0 &&
+      daa.getPersistencePreferredVerticalSpeedResolution() == 0.0 &&
+      daa.getPersistencePreferredAltitudeResolution() == 0.0;
+}
+
+static void compute_dimension(Daidalus& daa, int dim, const std::string& u, DimensionBands& bands) {
+  int n = 0;
+  switch (dim) {
+  case 0:
+    n = daa.horizontalDirectionBandsLength();
+    for (int i=0; i < n; ++i) {
+      bands.intervals.push_back(daa.horizontalDirectionIntervalAt(i,u));
+      bands.regions.push_back(region2int(daa.horizontalDirectionRegionAt(i)));
+    }
+    bands.resolution_low = daa.horizontalDirectionResolution(false,u);
+    bands.resolution_up = daa.horizontalDirectionResolution(true,u);
+    bands.preferred = daa.preferredHorizontalDirectionRightOrLeft();
+    bands.recovery = daa.horizontalDirectionRecoveryInformation();
+    break;
+  case 1:
+    n = daa.horizontalSpeedBandsLength();
+    for (int i=0; i < n; ++i) {
+      bands.intervals.push_back(daa.horizontalSpeedIntervalAt(i,u));
+      bands.regions.push_back(region2int(daa.horizontalSpeedRegionAt(i)));
+    }
+    bands.resolution_low = daa.horizontalSpeedResolution(false,u);
+    bands.resolution_up = daa.horizontalSpeedResolution(true,u);
+    bands.preferred = daa.preferredHorizontalSpeedUpOrDown();
+    bands.recovery = daa.horizontalSpeedRecoveryInformation();
+    break;
+  case 2:
+    n = daa.verticalSpeedBandsLength();
+    for (int i=0; i < n; ++i) {
+      bands.intervals.push_back(daa.verticalSpeedIntervalAt(i,u));
+      bands.regions.push_back(region2int(daa.verticalSpeedRegionAt(i)));
+    }
+    bands.resolution_low = daa.verticalSpeedResolution(false,u);
+    bands.resolution_up = daa.verticalSpeedResolution(true,u);
+    bands.preferred = daa.preferredVerticalSpeedUpOrDown();
+    bands.recovery = daa.verticalSpeedRecoveryInformation();
+    break;
+  default:
+    n = daa.altitudeBandsLength();
+    for (int i=0; i < n; ++i) {
+      bands.intervals.push_back(daa.altitudeIntervalAt(i,u));
+      bands.regions.push_back(region2int(daa.altitudeRegionAt(i)));
+    }
+    bands.resolution_low = daa.altitudeResolution(false,u);
+    bands.resolution_up = daa.altitudeResolution(true,u);
+    bands.preferred = daa.preferredAltitudeUpOrDown();
+    bands.recovery = daa.altitudeRecoveryInformation();
+    break;
+  }
+}
+
+/*
+ * Compute time steps [from,to) of the encounter in input file. The object daa is configured, but it 
+ * doesn't have any aircraft state.
+ */
+static void compute_steps(Daidalus daa, const std::string& input, int from, int to, 
+    const std::string* units, std::vector<TimeStep>& steps) {
+  DaidalusFileWalker walker(input);
+  walker.goToTimeStep(from);
+  for (int k=from; k < to && !walker.atEnd(); ++k) {
+    walker.readState(daa);
+    TimeStep& step = steps[k];
+    step.time = daa.getCurrentTime();
+    const TrafficState& own = daa.getOwnshipState();
+    step.ownship = own.getId();
+    step.trko = Units::to("deg",Util::to_pi(own.horizontalDirection()));
+    step.gso = Units::to(units[1],own.horizontalSpeed());
+    step.vso = Units::to(units[2],own.verticalSpeed());
+    step.alto = Units::to(units[3],own.altitude());
+    for (int ac=1; ac <= daa.lastTrafficIndex(); ++ac) {
+      int alert = daa.alertLevel(ac);
+      if (alert > 0) {
+        step.alerts.push_back(std::pair<std::string,int>(daa.getAircraftStateAt(ac).getId(),alert));
+      }
+    }
+    for (int dim=0; dim < NUMBER_OF_DIMENSIONS; ++dim) {
+      compute_dimension(daa,dim,units[dim],step.bands[dim]);
+    }
+    step.most_severe_alert_level = daa.lastTrafficIndex() >= 1 ? daa.mostSevereAlertLevel(1) : 0;
+  }
+}
+
+static void write_draw(std::ostream& out, const Daidalus& daa, const std::string& scenario, 
+    const std::string* units, const std::vector<TimeStep>& steps) {
+  out << "# This file can be processed with the Python script drawmultibands.py" << std::endl;
+  out << "Scenario:" << scenario << std::endl;
+  out << "Ownship:" << (steps.empty() ? "" : steps.back().ownship) << std::endl;
+  out << "# Bands Encoding" << std::endl;
+  out << "# NONE = " << region2int(BandsRegion::NONE) << std::endl;
+  out << "# FAR = " << region2int(BandsRegion::FAR) << std::endl;
+  out << "# MID = " << region2int(BandsRegion::MID) << std::endl;
+  out << "# NEAR = " << region2int(BandsRegion::NEAR) << std::endl;
+  out << "# RECOVERY = " << region2int(BandsRegion::RECOVERY) << std::endl;
+  out << "MinMaxGs:" << FmPrecision(daa.getMinHorizontalSpeed(units[1])) << " " <<
+      FmPrecision(daa.getMaxHorizontalSpeed(units[1])) << ":" << units[1] << std::endl;
+  out << "MinMaxVs:" << FmPrecision(daa.getMinVerticalSpeed(units[2])) << " " <<
+      FmPrecision(daa.getMaxVerticalSpeed(units[2])) << ":" << units[2] << std::endl;
+  out << "MinMaxAlt:" << FmPrecision(daa.getMinAltitude(units[3])) << " " <<
+      FmPrecision(daa.getMaxAltitude(units[3])) << ":" << units[3] << std::endl;
+  for (int dim=0; dim < NUMBER_OF_DIMENSIONS; ++dim) {
+    for (int k=0; k < (int)steps.size(); ++k) {
+      const DimensionBands& bands = steps[k].bands[dim];
+      out << draw_names[dim] << ":" << FmPrecision(steps[k].time) << ":";
+      for (int i=0; i < (int)bands.intervals.size(); ++i) {
+        out << bands.intervals[i].toString() << " " << bands.regions[i] << " ";
+      }
+      out << std::endl;
+    }
+  }
+  out << "MostSevereAlertLevel:" << (steps.empty() ? 0 : steps.back().most_severe_alert_level) << std::endl;
+  std::map<std::string,std::string> alerting_times;
+  for (int k=0; k < (int)steps.size(); ++k) {
+    for (int i=0; i < (int)steps[k].alerts.size(); ++i) {
+      std::string& times = alerting_times[steps[k].alerts[i].first];
+      if (times.empty()) {
+        times = "AlertingTimes:"+steps[k].alerts[i].first+":";
+      }
+      times += FmPrecision(steps[k].time)+" "+Fmi(steps[k].alerts[i].second)+" ";
+    }
+  }
+  for (std::map<std::string,std::string>::const_iterator ptr = alerting_times.begin(); ptr != alerting_times.end(); ++ptr) {
+    out << ptr->second << std::endl;
+  }
+  std::string str_to = "";
+  std::string str_trko = "";
+  std::string str_gso = "";
+  std::string str_vso = "";
+  std::string str_alto = "";
+  for (int k=0; k < (int)steps.size(); ++k) {
+    str_to += FmPrecision(steps[k].time)+" ";
+    str_trko += FmPrecision(steps[k].trko)+" ";
+    str_gso += FmPrecision(steps[k].gso)+" ";
+    str_vso += FmPrecision(steps[k].vso)+" ";
+    str_alto += FmPrecision(steps[k].alto)+" ";
+  }
+  out << "Times:" << str_to << std::endl;
+  out << "OwnTrk:" << str_trko << std::endl;
+  out << "OwnGs:" << str_gso << std::endl;
+  out << "OwnVs:" << str_vso << std::endl;
+  out << "OwnAlt:" << str_alto << std::endl;
+}
+
+/**** Columnar output ****/
+
+static void put_int(std::ostream& out, int i) {
+  out.write((const char*)&i,sizeof(int));
+}
+
+static void put_string(std::ostream& out, const std::string& str) {
+  put_int(out,(int)str.size());
+  out.write(str.data(),str.size());
+}
+
+static void put_column(std::ostream& out, const std::string& name, const std::string& units, const std::vector<double>& col) {
+  put_string(out,name);
+  put_string(out,units);
+  out.put('d');
+  put_int(out,(int)col.size());
+  out.write((const char*)col.data(),col.size()*sizeof(double));
+}
+
+static void put_column(std::ostream& out, const std::string& name, const std::string& units, const std::vector<int>& col) {
+  put_string(out,name);
+  put_string(out,units);
+  out.put('i');
+  put_int(out,(int)col.size());
+  out.write((const char*)col.data(),col.size()*sizeof(int));
+}
+
+static void put_column(std::ostream& out, const std::string& name, const std::vector<signed char>& col) {
+  put_string(out,name);
+  put_string(out,"unitless");
+  out.put('b');
+  put_int(out,(int)col.size());
+  out.write((const char*)col.data(),col.size());
+}
+
+static void write_columns(std::ostream& out, const std::string* units, const std::string& hunits, 
+    const std::string& vunits, const std::vector<TimeStep>& steps) {
+  int n = (int)steps.size();
+  out.write("DAMB",4);
+  put_int(out,1);
+  put_int(out,n);
+  put_int(out,7+12*NUMBER_OF_DIMENSIONS);
+  std::vector<double> col(n);
+  std::vector<int> icol(n);
+  for (int k=0; k < n; ++k) col[k] = steps[k].time;
+  put_column(out,"time","s",col);
+  for (int k=0; k < n; ++k) col[k] = steps[k].trko;
+  put_column(out,"own_trk","deg",col);
+  for (int k=0; k < n; ++k) col[k] = steps[k].gso;
+  put_column(out,"own_gs",units[1],col);
+  for (int k=0; k < n; ++k) col[k] = steps[k].vso;
+  put_column(out,"own_vs",units[2],col);
+  for (int k=0; k < n; ++k) col[k] = steps[k].alto;
+  put_column(out,"own_alt",units[3],col);
+  for (int k=0; k < n; ++k) {
+    icol[k] = 0;
+    for (int i=0; i < (int)steps[k].alerts.size(); ++i) {
+      icol[k] = std::max(icol[k],steps[k].alerts[i].second);
+    }
+  }
+  put_column(out,"max_alert_level","unitless",icol);
+  for (int k=0; k < n; ++k) icol[k] = steps[k].most_severe_alert_level;
+  put_column(out,"most_severe_alert_level","unitless",icol);
+  for (int dim=0; dim < NUMBER_OF_DIMENSIONS; ++dim) {
+    std::string d = dim_names[dim];
+    std::vector<double> low, up;
+    std::vector<signed char> region;
+    for (int k=0; k < n; ++k) {
+      const DimensionBands& bands = steps[k].bands[dim];
+      icol[k] = (int)bands.intervals.size();
+      for (int i=0; i < (int)bands.intervals.size(); ++i) {
+        low.push_back(bands.intervals[i].low);
+        up.push_back(bands.intervals[i].up);
+        region.push_back((signed char)bands.regions[i]);
+      }
+    }
+    put_column(out,d+"_count","unitless",icol);
+    put_column(out,d+"_low",units[dim],low);
+    put_column(out,d+"_up",units[dim],up);
+    put_column(out,d+"_region",region);
+    for (int k=0; k < n; ++k) col[k] = steps[k].bands[dim].resolution_low;
+    put_column(out,d+"_resolution_low",units[dim],col);
+    for (int k=0; k < n; ++k) col[k] = steps[k].bands[dim].resolution_up;
+    put_column(out,d+"_resolution_up",units[dim],col);
+    std::vector<signed char> bcol(n);
+    for (int k=0; k < n; ++k) bcol[k] = steps[k].bands[dim].preferred ? 1 : 0;
+    put_column(out,d+"_preferred_up",bcol);
+    for (int k=0; k < n; ++k) col[k] = steps[k].bands[dim].recovery.timeToRecovery();
+    put_column(out,d+"_time_to_recovery","s",col);
+    for (int k=0; k < n; ++k) icol[k] = steps[k].bands[dim].recovery.nFactor();
+    put_column(out,d+"_recovery_nfactor","unitless",icol);
+    for (int k=0; k < n; ++k) col[k] = steps[k].bands[dim].recovery.recoveryHorizontalDistance(hunits);
+    put_column(out,d+"_recovery_horizontal_distance",hunits,col);
+    for (int k=0; k < n; ++k) col[k] = steps[k].bands[dim].recovery.recoveryVerticalDistance(vunits);
+    put_column(out,d+"_recovery_vertical_distance",vunits,col);
+    for (int k=0; k < n; ++k) bcol[k] = steps[k].bands[dim].recovery.recoveryBandsSaturated() ? 1 : 0;
+    put_column(out,d+"_recovery_saturated",bcol);
+  }
+}
+
+int main(int argc, char* argv[]) {
+  // Declare an empty Daidalus object
+  Daidalus daa;
+
+  std::string input_file = "";
+  std::string output_file = "";
+  std::string conf = "";
+  bool no_hyst = false;
+  int threads = Executor::defaultExecutor().concurrency();
+  std::unique_ptr<Executor> pool;
+
+  for (int a=1;a < argc; ++a) {
+    std::string arga = argv[a];
+    if ((startsWith(arga,"--c") || startsWith(arga,"-c"))  && a+1 < argc) {
+      // Load configuration file
+      arga = argv[++a];
+      if (!daa.loadFromFile(arga)) {
+        if (arga == "sum") {
+          // Configure DAIDALUS as in DO-365B, with SUM. This is the default.
+          daa.set_DO_365B(true,true);
+        } else if (arga == "no_sum") {
+          // Configure DAIDALUS as in DO-365B, without SUM
+          daa.set_DO_365B(true,false);
+        } else if (arga == "nom_a") {
+          // Configure DAIDALUS to Nominal A: Buffered DWC, Kinematic Bands, Turn Rate 1.5 [deg/s]
+          daa.set_Buffered_WC_DO_365(false);
+        } else if (arga == "nom_b") {
+          // Configure DAIDALUS to Nominal B: Buffered DWS, Kinematic Bands, Turn Rate 3.0 [deg/s]
+          daa.set_Buffered_WC_DO_365(true);
+        } else if (arga == "cd3d") {
+          // Configure DAIDALUS to CD3D parameters: Cylinder (5nmi,1000ft), Instantaneous Bands, Only Corrective Volume
+          daa.set_CD3D();
+        } else if (arga == "tcasii") {
+          // Configure DAIDALUS to ideal TCASII logic: TA is Preventive Volume and RA is Corrective One
+          daa.set_TCASII();
+        } else {
+          std::cerr << "** Error: File " << arga << " not found" << std::endl;
+          exit(1);
+        }
+      }
+      conf = arga;
+    } else if ((startsWith(arga,"--o") || startsWith(arga,"-o")) && a+1 < argc) {
+      output_file = argv[++a];
+    } else if (startsWith(arga,"--nohys") || startsWith(arga,"-nohys")) {
+      // Use the given configuration, but disable hysteresis
+      no_hyst = true;
+    } else if ((startsWith(arga,"--thr") || startsWith(arga,"-thr")) && a+1 < argc) {
+      std::istringstream(argv[++a]) >> threads;
+      threads = std::max(1,threads);
+      pool.reset(new WorkStealingExecutor(threads));
+      daa.setExecutor(*pool);
+    } else if (startsWith(arga,"--h") || startsWith(arga,"-h")) {
+      std::cerr << "Generates a file that can be processed with the Python script drawmultibands.py" << std::endl;
+      std::cerr << "Usage:" << std::endl;
+      std::cerr << "  DaidalusMultiBands [<option>] <daa_file>" << std::endl;
+      std::cerr << "  <option> can be" << std::endl;
+      std::cerr << "  --config <configuration-file> | sum | no_sum | nom_a | nom_b | cd3d | tcasii\n\tLoad <configuration-file>" << std::endl;
+      std::cerr << "  --output <file.draw>\n\tOutput file <file.draw>. Columnar output is written to <file.mbands>" << std::endl;
+      std::cerr << "  --nohys\n\tDisable hysteresis" << std::endl;
+      std::cerr << "  --threads <n>\n\tMaximum number of threads used when hysteresis is disabled" << std::endl;
+      exit(0);
+    } else if (startsWith(arga,"-")){
+      std::cerr << "** Error: Unknown option " << arga << std::endl;
+      exit(1);
+    } else if (input_file == "") {
+      input_file = arga;
+    } else {
+      std::cerr << "** Error: Only one input file can be provided (" << a << ")" << std::endl;
+      exit(1);
+    }
+  }
+  if (input_file == "") {
+    std::cerr << "** Error: Expecting exactly one input file. Try --help for usage." << std::endl;
+    exit(1);
+  }
+  std::ifstream file(input_file.c_str());
+  if (!file) {
+    std::cerr << "** Error: File " << input_file << " cannot be read" << std::endl;
+    exit(1);
+  }
+  file.close();
+  if (conf == "") {
+    // Configure alerters as in DO_365B Phase I, Phase II, and Non-Cooperative, with SUM
+    daa.set_DO_365B();
+  }
+  if (no_hyst) {
+    daa.disableHysteresis();
+  }
+  std::string name = input_file.substr(input_file.find_last_of("/\\") + 1);
+  std::string scenario = name.find('.') != std::string::npos ? name.substr(0,name.find_last_of('.')) : name;
+  if (output_file == "") {
+    output_file = scenario+".draw";
+  }
+  std::string columns_file = output_file.substr(0,output_file.find_last_of('.') == std::string::npos ||
+      output_file.find_last_of('.') < output_file.find_last_of("/\\")+1 ? output_file.size() : output_file.find_last_of('.'))+".mbands";
+  std::ofstream out(output_file.c_str());
+  std::ofstream cols(columns_file.c_str(),std::ios::out | std::ios::binary);
+  if (!out || !cols) {
+    std::cerr << "** Error: Cannot write files " << output_file << " and " << columns_file << std::endl;
+    exit(1);
+  }
+  std::cout << "Writing file " << output_file << ", which can be processed with the Python script drawmultibands.py" << std::endl;
+  std::cout << "Writing columnar file " << columns_file << std::endl;
+
+  std::string units[NUMBER_OF_DIMENSIONS] = {"deg",daa.getUnitsOf("step_hs"),daa.getUnitsOf("step_vs"),daa.getUnitsOf("step_alt")};
+  DaidalusFileWalker walker(input_file);
+  int n = walker.indexOfTime(walker.lastTime())+1;
+  std::vector<TimeStep> steps(n);
+  if (!hysteresis_disabled(daa)) {
+    // Time steps depend on previous ones
+    threads = 1;
+  }
+  threads = std::max(1,std::min(threads,n));
+  if (threads == 1) {
+    compute_steps(daa,input_file,0,n,units,steps);
+  } else {
+    // Each task has its own copy of daa
+    TaskGroup group;
+    for (int k=0; k < threads; ++k) {
+      daa.getExecutor().submit(group,std::bind(compute_steps,daa,std::cref(input_file),n*k/threads,n*(k+1)/threads,
+          units,std::ref(steps)));
+    }
+    daa.getExecutor().wait(group);
+  }
+  write_draw(out,daa,scenario,units,steps);
+  write_columns(cols,units,daa.getUnitsOf("min_horizontal_recovery"),daa.getUnitsOf("min_vertical_recovery"),steps);
+  out.close();
+  cols.close();
+  return 0;
+}
@@ -0,0 +1,545 @@
+/*
+ * Copyright (c) 2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+/**
+
+Notices:
+
+Copyright 2016 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration. No
+copyright is claimed in the United States under Title 17,
+U.S. Code. All Other Rights Reserved.
+
+Disclaimers
+
+No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY
+WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY,
+INCLUDING, BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE
+WILL CONFORM TO SPECIFICATIONS, ANY IMPLIED WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR FREEDOM FROM
+INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER,
+CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT
+OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY
+OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.
+FURTHER, GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES
+REGARDING THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE,
+AND DISTRIBUTES IT "AS IS."
+
+Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS
+AGAINST THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND
+SUBCONTRACTORS, AS WELL AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF
+THE SUBJECT SOFTWARE RESULTS IN ANY LIABILITIES, DEMANDS, DAMAGES,
+EXPENSES OR LOSSES ARISING FROM SUCH USE, INCLUDING ANY DAMAGES FROM
+PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S USE OF THE SUBJECT
+SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE UNITED
+STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE
+REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL
+TERMINATION OF THIS AGREEMENT.
+ **/
+
+/*
+ * This application computes alerts and horizontal direction bands for a fleet where every aircraft is an
+ * ownship, e.g., the aircraft of an encounter file or a random fleet over the continental US. The fleet
+ * is partitioned into geographic shards (see FleetShards), which are computed by worker processes
+ * that communicate with this process, the coordinator, through Unix sockets. Each worker receives the
+ * ownships of its shard and the traffic aircraft within the alerting reach of the shard (the halo), and
+ * keeps one Daidalus object per ownship. When shards are rebalanced, the runtime state of ownships that move
+ * to another shard is transferred with Daidalus::serializeState and Daidalus::restoreState. The coordinator
+ * merges the results of all workers. With --workers 0, all ownships are computed by the coordinator
+ * using all traffic aircraft, which can be used to check the output of the sharded computation.
+ * This application requires a POSIX system.
+ */
+
+#include "Daidalus.h"
+#include "DaidalusFileWalker.h"
+#include "FleetShards.h"
+#include "format.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <set>
+#include <vector>
+#include <string>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+using namespace larcfm;
+
+/*
+ * State of an aircraft at a given time
+ */
+class Aircraft {
+public:
+  std::string id;
+  Position pos;
+  Velocity vel;
+
+  bool operator<(const Aircraft& ac) const {
+    return id < ac.id;
+  }
+};
+
+/*
+ * States of all aircraft at a given time
+ */
+class FleetStep {
+public:
+  double time;
+  std::vector<Aircraft> fleet;
+};
+
+/*
+ * Connection to a worker process
+ */
+class Worker {
+public:
+  pid_t pid;
+  FILE* in;
+  FILE* out;
+};
+
+static void fail(const std::string& msg) {
+  std::cerr << "** Error: " << msg << std::endl;
+  exit(1);
+}
+
+static void write_aircraft(FILE* out, const Aircraft& ac, bool own) {
+  if (ac.pos.isLatLon()) {
+    fprintf(out,"AC %s %d 1 %.17g %.17g %.17g",ac.id.c_str(),own ? 1 : 0,ac.pos.lat(),ac.pos.lon(),ac.pos.alt());
+  } else {
+    fprintf(out,"AC %s %d 0 %.17g %.17g %.17g",ac.id.c_str(),own ? 1 : 0,ac.pos.x(),ac.pos.y(),ac.pos.z());
+  }
+  fprintf(out," %.17g %.17g %.17g %.17g %.17g\n",ac.vel.trk(),ac.vel.gs(),ac.vel.x(),ac.vel.y(),ac.vel.z());
+}
+
+static bool read_aircraft(FILE* in, Aircraft& ac, bool& own) {
+  char id[256];
+  int own_flag, latlon;
+  double a, b, c, trk, gs, vx, vy, vz;
+  if (fscanf(in," AC %255s %d %d %lg %lg %lg %lg %lg %lg %lg %lg",id,&own_flag,&latlon,&a,&b,&c,&trk,&gs,&vx,&vy,&vz) != 11) {
+    return false;
+  }
+  ac.id = id;
+  own = own_flag != 0;
+  ac.pos = latlon ? Position::mkLatLonAlt(a,b,c) : Position::mkXYZ(a,b,c);
+  ac.vel = Velocity::mkTrkGsVxyz(trk,gs,vx,vy,vz);
+  return true;
+}
+
+static void write_blob(FILE* out, const std::string& tag, const std::string& id, const std::string& blob) {
+  fprintf(out,"%s %s %lu\n",tag.c_str(),id.c_str(),static_cast<unsigned long>(blob.size()));
+  fwrite(blob.data(),1,blob.size(),out);
+}
+
+static bool read_blob(FILE* in, const std::string& tag, std::string& id, std::string& blob) {
+  char str_tag[16];
+  char str_id[256];
+  unsigned long size;
+  if (fscanf(in," %15s %255s %lu",str_tag,str_id,&size) != 3 || tag != str_tag || fgetc(in) != '\n') {
+    return false;
+  }
+  id = str_id;
+  blob.resize(size);
+  return size == 0 || fread(&blob[0],1,size,in) == size;
+}
+
+/*
+ * Compute alerts and horizontal direction bands of ownship using all aircraft in fleet within reach as traffic.
+ * Return a line with the results.
+ */
+static std::string compute_ownship(Daidalus& daa, double time, const Aircraft& ownship,
+    const std::vector<Aircraft>& fleet, double reach) {
+  daa.setOwnshipState(ownship.id,ownship.pos,ownship.vel,time);
+  for (int i=0; i < static_cast<int>(fleet.size()); ++i) {
+    if (fleet[i].id != ownship.id && (reach < 0 || fleet[i].pos.distanceH(ownship.pos) <= reach)) {
+      daa.addTrafficState(fleet[i].id,fleet[i].pos,fleet[i].vel);
+    }
+  }
+  std::string s = FmPrecision(time)+" "+ownship.id+" alerts:";
+  for (int ac=1; ac <= daa.lastTrafficIndex(); ++ac) {
+    int alert = daa.alertLevel(ac);
+    if (alert > 0) {
+      s += " "+daa.getAircraftStateAt(ac).getId()+"="+Fmi(alert);
+    }
+  }
+  s += " bands:";
+  for (int i=0; i < daa.horizontalDirectionBandsLength(); ++i) {
+    Interval ii = daa.horizontalDirectionIntervalAt(i,"deg");
+    s += " ["+FmPrecision(ii.low)+","+FmPrecision(ii.up)+"]"+BandsRegion::to_string(daa.horizontalDirectionRegionAt(i));
+  }
+  return s;
+}
+
+/*
+ * Main loop of a worker process. Messages are
+ *   RELEASE <n> followed by n ownship identifiers: reply with the runtime state of these ownships, which are removed.
+ *   STEP <time> <n> <m> followed by n states (RESTORE) and m aircraft: reply with the results of the ownships
+ *   in the list of aircraft. Ownships that are not in the list are removed.
+ *   QUIT: exit
+ */
+static void worker_loop(FILE* in, FILE* out, const Daidalus& config, double reach) {
+  std::map<std::string,Daidalus> daas;
+  char cmd[16];
+  while (fscanf(in," %15s",cmd) == 1) {
+    std::string command = cmd;
+    if (command == "RELEASE") {
+      int n = 0;
+      if (fscanf(in,"%d",&n) != 1) {
+        fail("Worker: bad RELEASE message");
+      }
+      for (int i=0; i < n; ++i) {
+        char id[256];
+        if (fscanf(in," %255s",id) != 1) {
+          fail("Worker: bad RELEASE message");
+        }
+        std::string state;
+        std::map<std::string,Daidalus>::iterator daa_ptr = daas.find(id);
+        if (daa_ptr != daas.end()) {
+          daa_ptr->second.serializeState(state);
+          daas.erase(daa_ptr);
+        }
+        write_blob(out,"STATE",id,state);
+      }
+      fflush(out);
+    } else if (command == "STEP") {
+      double time;
+      int n, m;
+      if (fscanf(in,"%lg %d %d",&time,&n,&m) != 3) {
+        fail("Worker: bad STEP message");
+      }
+      for (int i=0; i < n; ++i) {
+        std::string id;
+        std::string state;
+        if (!read_blob(in,"RESTORE",id,state)) {
+          fail("Worker: bad RESTORE message");
+        }
+        Daidalus& daa = daas.insert(std::make_pair(id,config)).first->second;
+        if (!state.empty()) {
+          daa.restoreState(state);
+        }
+      }
+      std::vector<Aircraft> fleet(m);
+      std::vector<bool> own(m);
+      for (int i=0; i < m; ++i) {
+        bool own_i;
+        if (!read_aircraft(in,fleet[i],own_i)) {
+          fail("Worker: bad AC message");
+        }
+        own[i] = own_i;
+      }
+      std::set<std::string> owned;
+      std::vector<std::string> lines;
+      for (int i=0; i < m; ++i) {
+        if (own[i]) {
+          // Daidalus objects are not copied, since copies do not keep hysteresis information
+          Daidalus& daa = daas.insert(std::make_pair(fleet[i].id,config)).first->second;
+          lines.push_back(compute_ownship(daa,time,fleet[i],fleet,reach));
+          owned.insert(fleet[i].id);
+        }
+      }
+      for (std::map<std::string,Daidalus>::iterator daa_ptr = daas.begin(); daa_ptr != daas.end();) {
+        if (owned.find(daa_ptr->first) == owned.end()) {
+          daas.erase(daa_ptr++);
+        } else {
+          ++daa_ptr;
+        }
+      }
+      fprintf(out,"OUT %d\n",static_cast<int>(lines.size()));
+      for (int i=0; i < static_cast<int>(lines.size()); ++i) {
+        fprintf(out,"%s\n",lines[i].c_str());
+      }
+      fflush(out);
+    } else {
+      break;
+    }
+  }
+}
+
+static Worker start_worker(const Daidalus& config, double reach, const std::vector<Worker>& workers) {
+  int sv[2];
+  if (socketpair(AF_UNIX,SOCK_STREAM,0,sv) != 0) {
+    fail("Socket pair cannot be created");
+  }
+  pid_t pid = fork();
+  if (pid < 0) {
+    fail("Worker process cannot be created");
+  }
+  if (pid == 0) {
+    close(sv[0]);
+    for (int i=0; i < static_cast<int>(workers.size()); ++i) {
+      fclose(workers[i].in);
+      fclose(workers[i].out);
+    }
+    FILE* in = fdopen(sv[1],"r");
+    FILE* out = fdopen(dup(sv[1]),"w");
+    worker_loop(in,out,config,reach);
+    exit(0);
+  }
+  close(sv[1]);
+  Worker worker;
+  worker.pid = pid;
+  worker.in = fdopen(sv[0],"r");
+  worker.out = fdopen(dup(sv[0]),"w");
+  return worker;
+}
+
+static void read_output(FILE* in, std::vector<std::string>& lines) {
+  int n = 0;
+  if (fscanf(in," OUT %d",&n) != 1 || fgetc(in) != '\n') {
+    fail("Coordinator: bad OUT message");
+  }
+  char buffer[65536];
+  for (int i=0; i < n; ++i) {
+    if (fgets(buffer,sizeof(buffer),in) == NULL) {
+      fail("Coordinator: bad OUT message");
+    }
+    std::string line = buffer;
+    lines.push_back(line.substr(0,line.size()-1));
+  }
+}
+
+static void read_scenario(const std::string& input_file, Daidalus& daa, std::vector<FleetStep>& steps) {
+  DaidalusFileWalker walker(input_file);
+  while (!walker.atEnd()) {
+    walker.readState(daa);
+    FleetStep step;
+    step.time = daa.getCurrentTime();
+    for (int ac=0; ac <= daa.lastTrafficIndex(); ++ac) {
+      Aircraft aircraft;
+      aircraft.id = daa.getAircraftStateAt(ac).getId();
+      aircraft.pos = daa.getAircraftStateAt(ac).getPosition();
+      aircraft.vel = daa.getAircraftStateAt(ac).getGroundVelocity();
+      step.fleet.push_back(aircraft);
+    }
+    steps.push_back(step);
+  }
+  daa.clear();
+}
+
+/*
+ * Random fleet of n aircraft over the continental US flying straight and level for a given number of seconds
+ */
+static void random_fleet(int n, int seconds, std::vector<FleetStep>& steps) {
+  srand(1);
+  std::vector<Aircraft> fleet(n);
+  for (int i=0; i < n; ++i) {
+    fleet[i].id = "AC"+Fmi(i);
+    double lat = 25.0+24.0*rand()/RAND_MAX;
+    double lon = -125.0+58.0*rand()/RAND_MAX;
+    double alt = 2000.0+30000.0*rand()/RAND_MAX;
+    fleet[i].pos = Position::makeLatLonAlt(lat,"deg",lon,"deg",alt,"ft");
+    fleet[i].vel = Velocity::makeTrkGsVs(360.0*rand()/RAND_MAX,"deg",100.0+400.0*rand()/RAND_MAX,"kn",0.0,"fpm");
+  }
+  for (int t=0; t <= seconds; ++t) {
+    FleetStep step;
+    step.time = t;
+    for (int i=0; i < n; ++i) {
+      Aircraft aircraft = fleet[i];
+      aircraft.pos = fleet[i].pos.linear(fleet[i].vel,t);
+      step.fleet.push_back(aircraft);
+    }
+    steps.push_back(step);
+  }
+}
+
+int main(int argc, char* argv[]) {
+  Daidalus daa;
+  std::string input_file = "";
+  std::string output_file = "";
+  int workers_n = 4;
+  int random_n = 0;
+  int seconds = 10;
+  double closure_speed = 0.0;
+  double max_imbalance = 1.2;
+
+  for (int a=1;a < argc; ++a) {
+    std::string arga = argv[a];
+    if ((startsWith(arga,"--c") || startsWith(arga,"-c"))  && a+1 < argc) {
+      arga = argv[++a];
+      if (!daa.loadFromFile(arga)) {
+        std::cerr << "** Error: File " << arga << " not found" << std::endl;
+        exit(1);
+      }
+    } else if ((startsWith(arga,"--o") || startsWith(arga,"-o")) && a+1 < argc) {
+      output_file = argv[++a];
+    } else if ((startsWith(arga,"--w") || startsWith(arga,"-w")) && a+1 < argc) {
+      std::istringstream(argv[++a]) >> workers_n;
+      workers_n = std::max(0,workers_n);
+    } else if ((startsWith(arga,"--r") || startsWith(arga,"-r")) && a+1 < argc) {
+      std::istringstream(argv[++a]) >> random_n;
+    } else if ((startsWith(arga,"--s") || startsWith(arga,"-s")) && a+1 < argc) {
+      std::istringstream(argv[++a]) >> seconds;
+    } else if ((startsWith(arga,"--closure") || startsWith(arga,"-closure")) && a+1 < argc) {
+      std::istringstream(argv[++a]) >> closure_speed;
+      closure_speed = Units::from("kn",closure_speed);
+    } else if ((startsWith(arga,"--imb") || startsWith(arga,"-imb")) && a+1 < argc) {
+      std::istringstream(argv[++a]) >> max_imbalance;
+    } else if (startsWith(arga,"--h") || startsWith(arga,"-h")) {
+      std::cerr << "Computes alerts and direction bands of a fleet where every aircraft is an ownship, using" << std::endl;
+      std::cerr << "worker processes that own geographic shards" << std::endl;
+      std::cerr << "Usage:" << std::endl;
+      std::cerr << "  DaidalusShards [<option>] [<daa_file>]" << std::endl;
+      std::cerr << "  <option> can be" << std::endl;
+      std::cerr << "  --config <configuration-file>\n\tLoad <configuration-file>" << std::endl;
+      std::cerr << "  --output <file>\n\tOutput file <file>" << std::endl;
+      std::cerr << "  --workers <n>\n\tNumber of worker processes (0: compute all ownships in this process, using all traffic)" << std::endl;
+      std::cerr << "  --random <n>\n\tUse a random fleet of <n> aircraft over the continental US instead of <daa_file>" << std::endl;
+      std::cerr << "  --seconds <n>\n\tNumber of seconds of the random fleet" << std::endl;
+      std::cerr << "  --closure <speed>\n\tMaximum horizontal closure speed in knots (default: twice maximum horizontal speed)" << std::endl;
+      std::cerr << "  --imbalance <r>\n\tRebalance shards when the largest shard exceeds <r> times the average (default: 1.2)" << std::endl;
+      exit(0);
+    } else if (startsWith(arga,"-")){
+      std::cerr << "** Error: Unknown option " << arga << std::endl;
+      exit(1);
+    } else if (input_file == "") {
+      input_file = arga;
+    } else {
+      std::cerr << "** Error: Only one input file can be provided (" << a << ")" << std::endl;
+      exit(1);
+    }
+  }
+  std::vector<FleetStep> steps;
+  if (random_n > 0) {
+    random_fleet(random_n,seconds,steps);
+  } else if (input_file != "") {
+    std::ifstream file(input_file.c_str());
+    if (!file) {
+      std::cerr << "** Error: File " << input_file << " cannot be read" << std::endl;
+      exit(1);
+    }
+    file.close();
+    read_scenario(input_file,daa,steps);
+  } else {
+    std::cerr << "** Error: Expecting an input file or a random fleet. Try --help for usage." << std::endl;
+    exit(1);
+  }
+  std::ofstream fout;
+  if (output_file != "") {
+    fout.open(output_file.c_str());
+  }
+  std::ostream& out = output_file != "" ? fout : std::cout;
+
+  double reach = FleetShards::alertingReach(daa,closure_speed);
+  FleetShards shards(reach);
+  std::vector<Worker> workers;
+  for (int w=0; w < workers_n; ++w) {
+    workers.push_back(start_worker(daa,reach,workers));
+  }
+  // Coordinator's Daidalus objects, when there are no workers
+  std::map<std::string,Daidalus> daas;
+  // Shard of each ownship in the previous time step
+  std::map<std::string,int> owner;
+  int rebalances = 0;
+  int migrations = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int s=0; s < static_cast<int>(steps.size()); ++s) {
+    std::vector<Aircraft>& fleet = steps[s].fleet;
+    std::sort(fleet.begin(),fleet.end());
+    std::vector<std::string> lines;
+    if (workers.empty()) {
+      for (int i=0; i < static_cast<int>(fleet.size()); ++i) {
+        Daidalus& own_daa = daas.insert(std::make_pair(fleet[i].id,daa)).first->second;
+        lines.push_back(compute_ownship(own_daa,steps[s].time,fleet[i],fleet,-1));
+      }
+    } else {
+      std::vector<Position> positions;
+      for (int i=0; i < static_cast<int>(fleet.size()); ++i) {
+        positions.push_back(fleet[i].pos);
+      }
+      if (s == 0 || shards.imbalance(positions) > max_imbalance) {
+        shards.balance(workers.size(),positions);
+        ++rebalances;
+      }
+      // Release ownships that move to another shard
+      std::vector<std::vector<std::string> > released(workers.size());
+      std::vector<int> shard_of(fleet.size());
+      for (int i=0; i < static_cast<int>(fleet.size()); ++i) {
+        shard_of[i] = shards.shardOf(fleet[i].pos);
+        std::map<std::string,int>::iterator owner_ptr = owner.find(fleet[i].id);
+        if (owner_ptr != owner.end() && owner_ptr->second != shard_of[i]) {
+          released[owner_ptr->second].push_back(fleet[i].id);
+          ++migrations;
+        }
+      }
+      std::map<std::string,std::string> states;
+      for (int w=0; w < static_cast<int>(workers.size()); ++w) {
+        if (!released[w].empty()) {
+          fprintf(workers[w].out,"RELEASE %d\n",static_cast<int>(released[w].size()));
+          for (int i=0; i < static_cast<int>(released[w].size()); ++i) {
+            fprintf(workers[w].out,"%s\n",released[w][i].c_str());
+          }
+          fflush(workers[w].out);
+        }
+      }
+      for (int w=0; w < static_cast<int>(workers.size()); ++w) {
+        for (int i=0; i < static_cast<int>(released[w].size()); ++i) {
+          std::string id;
+          std::string state;
+          if (!read_blob(workers[w].in,"STATE",id,state)) {
+            fail("Coordinator: bad STATE message");
+          }
+          states[id] = state;
+        }
+      }
+      // Send time step to all workers, then collect results
+      owner.clear();
+      for (int w=0; w < static_cast<int>(workers.size()); ++w) {
+        std::vector<int> halo;
+        std::vector<std::string> restore;
+        for (int i=0; i < static_cast<int>(fleet.size()); ++i) {
+          if (shards.inHalo(w,fleet[i].pos)) {
+            halo.push_back(i);
+          }
+          if (shard_of[i] == w) {
+            owner[fleet[i].id] = w;
+            if (states.find(fleet[i].id) != states.end()) {
+              restore.push_back(fleet[i].id);
+            }
+          }
+        }
+        fprintf(workers[w].out,"STEP %.17g %d %d\n",steps[s].time,static_cast<int>(restore.size()),static_cast<int>(halo.size()));
+        for (int i=0; i < static_cast<int>(restore.size()); ++i) {
+          write_blob(workers[w].out,"RESTORE",restore[i],states[restore[i]]);
+        }
+        for (int i=0; i < static_cast<int>(halo.size()); ++i) {
+          write_aircraft(workers[w].out,fleet[halo[i]],shard_of[halo[i]] == w);
+        }
+        fflush(workers[w].out);
+      }
+      for (int w=0; w < static_cast<int>(workers.size()); ++w) {
+        read_output(workers[w].in,lines);
+      }
+    }
+    // Merge results by ownship identifier
+    std::sort(lines.begin(),lines.end());
+    for (int i=0; i < static_cast<int>(lines.size()); ++i) {
+      out << lines[i] << std::endl;
+    }
+  }
+  double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+  for (int w=0; w < static_cast<int>(workers.size()); ++w) {
+    fprintf(workers[w].out,"QUIT\n");
+    fclose(workers[w].out);
+    fclose(workers[w].in);
+    waitpid(workers[w].pid,NULL,0);
+  }
+  std::cerr << "Time steps: " << steps.size() << ", workers: " << workers.size() << ", reach: " <<
+      Units::str("NM",reach) << ", rebalances: " << rebalances << ", migrations: " << migrations <<
+      ", elapsed time: " << FmPrecision(elapsed) << " [s]" << std::endl;
+  if (output_file != "") {
+    fout.close();
+  }
+  return 0;
+}
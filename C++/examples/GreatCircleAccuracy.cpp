@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+/**
+
+Notices:
+
+Copyright 2016 United States Government as represented by the
+Administrator of the National Aeronautics and Space Administration. No
+copyright is claimed in the United States under Title 17,
+U.S. Code. All Other Rights Reserved.
+
+Disclaimers
+
+No Warranty: THE SUBJECT SOFTWARE IS PROVIDED "AS IS" WITHOUT ANY
+WARRANTY OF ANY KIND, EITHER EXPRESSED, IMPLIED, OR STATUTORY,
+INCLUDING, BUT NOT LIMITED TO, ANY WARRANTY THAT THE SUBJECT SOFTWARE
+WILL CONFORM TO SPECIFICATIONS, ANY IMPLIED WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, OR FREEDOM FROM
+INFRINGEMENT, ANY WARRANTY THAT THE SUBJECT SOFTWARE WILL BE ERROR
+FREE, OR ANY WARRANTY THAT DOCUMENTATION, IF PROVIDED, WILL CONFORM TO
+THE SUBJECT SOFTWARE. THIS AGREEMENT DOES NOT, IN ANY MANNER,
+CONSTITUTE AN ENDORSEMENT BY GOVERNMENT AGENCY OR ANY PRIOR RECIPIENT
+OF ANY RESULTS, RESULTING DESIGNS, HARDWARE, SOFTWARE PRODUCTS OR ANY
+OTHER APPLICATIONS RESULTING FROM USE OF THE SUBJECT SOFTWARE.
+FURTHER, GOVERNMENT AGENCY DISCLAIMS ALL WARRANTIES AND LIABILITIES
+REGARDING THIRD-PARTY SOFTWARE, IF PRESENT IN THE ORIGINAL SOFTWARE,
+AND DISTRIBUTES IT "AS IS."
+
+Waiver and Indemnity: RECIPIENT AGREES TO WAIVE ANY AND ALL CLAIMS
+AGAINST THE UNITED STATES GOVERNMENT, ITS CONTRACTORS AND
+SUBCONTRACTORS, AS WELL AS ANY PRIOR RECIPIENT.  IF RECIPIENT'S USE OF
+THE SUBJECT SOFTWARE RESULTS IN ANY LIABILITIES, DEMANDS, DAMAGES,
+EXPENSES OR LOSSES ARISING FROM SUCH USE, INCLUDING ANY DAMAGES FROM
+PRODUCTS BASED ON, OR RESULTING FROM, RECIPIENT'S USE OF THE SUBJECT
+SOFTWARE, RECIPIENT SHALL INDEMNIFY AND HOLD HARMLESS THE UNITED
+STATES GOVERNMENT, ITS CONTRACTORS AND SUBCONTRACTORS, AS WELL AS ANY
+PRIOR RECIPIENT, TO THE EXTENT PERMITTED BY LAW.  RECIPIENT'S SOLE
+REMEDY FOR ANY SUCH MATTER SHALL BE THE IMMEDIATE, UNILATERAL
+TERMINATION OF THIS AGREEMENT.
+ **/
+
+/*
+ * This application reports the accuracy and the running time of the fast estimates
+ * in GreatCircle, Position, and KinematicsLatLon (methods with suffix est/Est) with
+ * respect to their exact counterparts. Errors are sampled over a grid of latitudes,
+ * bearings, and ranges.
+ */
+
+#include "GreatCircle.h"
+#include "KinematicsLatLon.h"
+#include "Position.h"
+#include "Units.h"
+#include "Util.h"
+#include "format.h"
+#include "string_util.h"
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <sstream>
+
+using namespace larcfm;
+
+static double elapsed_ns(const std::chrono::steady_clock::time_point& start, int n) {
+  return std::chrono::duration<double,std::nano>(std::chrono::steady_clock::now()-start).count()/n;
+}
+
+static void accuracy(double max_lat, double max_range) {
+  double max_dist_rel = 0.0;
+  double max_crs = 0.0;
+  double max_linear = 0.0;
+  double max_turn = 0.0;
+  for (double lat = -max_lat; lat <= max_lat; lat += 5.0) {
+    LatLonAlt so = LatLonAlt::make(lat,-75.0,10000.0);
+    for (double trk = 0.0; trk < 360.0; trk += 7.5) {
+      for (double range = 0.1; range <= max_range; range += 0.1) {
+        LatLonAlt p = GreatCircle::linear_initial(so,Units::from("deg",trk),Units::from("nmi",range));
+        double d = GreatCircle::angular_distance(so,p);
+        max_dist_rel = Util::max(max_dist_rel,std::abs(GreatCircle::angular_distance_est(so,p)-d)/d);
+        max_crs = Util::max(max_crs,std::abs(Util::to_pi(GreatCircle::initial_course_est(so,p)-GreatCircle::initial_course(so,p))));
+        // Time needed to cover range at 250 knots
+        Velocity v = Velocity::makeTrkGsVs(trk,"deg",250,"kn",0,"fpm");
+        double t = Units::from("nmi",range)/v.gs();
+        LatLonAlt q = KinematicsLatLon::linear(so,v,t).first;
+        max_linear = Util::max(max_linear,GreatCircle::distance(q,GreatCircle::linear_initial_est(so,v,t)));
+        double omega = Units::from("deg/s",3.0);
+        q = KinematicsLatLon::turnOmega(so,v,t,omega).first;
+        max_turn = Util::max(max_turn,GreatCircle::distance(q,KinematicsLatLon::turnOmegaEst(so,v,t,omega).first));
+      }
+    }
+  }
+  std::cout << "Latitudes up to " << Fm1(max_lat) << " [deg], ranges up to " << Fm1(max_range) << " [nmi]" << std::endl;
+  std::cout << "  angular_distance_est: max relative error " << FmPrecision(100*max_dist_rel,4) << " [%]" << std::endl;
+  std::cout << "  initial_course_est: max error " << FmPrecision(Units::to("deg",max_crs),4) << " [deg]" << std::endl;
+  std::cout << "  linear_initial_est: max error " << Fm2(max_linear) << " [m]" << std::endl;
+  std::cout << "  turnOmegaEst (3 [deg/s]): max error " << Fm2(max_turn) << " [m]" << std::endl;
+}
+
+static void timing(int n) {
+  std::vector<LatLonAlt> pts;
+  for (int i=0; i < 360; ++i) {
+    pts.push_back(GreatCircle::linear_initial(LatLonAlt::make(40.0,-75.0,10000.0),Units::from("deg",i),Units::from("nmi",1+i%10)));
+  }
+  LatLonAlt so = LatLonAlt::make(40.0,-75.0,10000.0);
+  Velocity v = Velocity::makeTrkGsVs(30,"deg",250,"kn",0,"fpm");
+  double acc = 0.0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (int i=0; i < n; ++i) {
+    acc += GreatCircle::angular_distance(so,pts[i%360]);
+  }
+  double exact = elapsed_ns(start,n);
+  start = std::chrono::steady_clock::now();
+  for (int i=0; i < n; ++i) {
+    acc += GreatCircle::angular_distance_est(so,pts[i%360]);
+  }
+  std::cout << "angular_distance: " << Fm1(exact) << " [ns], angular_distance_est: " << Fm1(elapsed_ns(start,n)) << " [ns]" << std::endl;
+  start = std::chrono::steady_clock::now();
+  for (int i=0; i < n; ++i) {
+    acc += GreatCircle::initial_course(so,pts[i%360]);
+  }
+  exact = elapsed_ns(start,n);
+  start = std::chrono::steady_clock::now();
+  for (int i=0; i < n; ++i) {
+    acc += GreatCircle::initial_course_est(so,pts[i%360]);
+  }
+  std::cout << "initial_course: " << Fm1(exact) << " [ns], initial_course_est: " << Fm1(elapsed_ns(start,n)) << " [ns]" << std::endl;
+  start = std::chrono::steady_clock::now();
+  for (int i=0; i < n; ++i) {
+    acc += KinematicsLatLon::linear(so,v,i%300).first.lat();
+  }
+  exact = elapsed_ns(start,n);
+  start = std::chrono::steady_clock::now();
+  for (int i=0; i < n; ++i) {
+    acc += GreatCircle::linear_initial_est(so,v,i%300).lat();
+  }
+  std::cout << "KinematicsLatLon::linear: " << Fm1(exact) << " [ns], linear_initial_est: " << Fm1(elapsed_ns(start,n)) << " [ns]" << std::endl;
+  double omega = Units::from("deg/s",3.0);
+  start = std::chrono::steady_clock::now();
+  for (int i=0; i < n; ++i) {
+    acc += KinematicsLatLon::turnOmega(so,v,i%120,omega).first.lat();
+  }
+  exact = elapsed_ns(start,n);
+  start = std::chrono::steady_clock::now();
+  for (int i=0; i < n; ++i) {
+    acc += KinematicsLatLon::turnOmegaEst(so,v,i%120,omega).first.lat();
+  }
+  std::cout << "KinematicsLatLon::turnOmega: " << Fm1(exact) << " [ns], turnOmegaEst: " << Fm1(elapsed_ns(start,n)) << " [ns]" << std::endl;
+  // Prevent the compiler from removing the loops
+  if (ISNAN(acc)) {
+    std::cout << acc << std::endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  int n = 1000000;
+  for (int a=1;a < argc; ++a) {
+    std::string arga = argv[a];
+    if ((startsWith(arga,"--n") || startsWith(arga,"-n")) && a+1 < argc) {
+      ++a;
+      std::istringstream(argv[a]) >> n;
+    } else if (startsWith(arga,"--h") || startsWith(arga,"-h")) {
+      std::cerr << "Usage:" << std::endl;
+      std::cerr << "  GreatCircleAccuracy [--n <iterations>]" << std::endl;
+      exit(0);
+    }
+  }
+  std::cout << "** Accuracy of fast estimates" << std::endl;
+  accuracy(60.0,10.0);
+  accuracy(80.0,10.0);
+  accuracy(60.0,50.0);
+  std::cout << std::endl << "** Average running time per call (" << n << " iterations)" << std::endl;
+  timing(n);
+  return 0;
+}
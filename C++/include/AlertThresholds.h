@@ -217,6 +217,11 @@ public:
    */
   void setAltitudeSpread(double spread, const std::string& u);
 
+  /**
+   * @return estimated number of bytes allocated by this object, including its detector, but not the object itself
+   */
+  int memoryUsage() const;
+
   std::string toString() const;
 
   std::string toPVS() const;
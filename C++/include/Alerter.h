@@ -331,6 +331,11 @@ public:
 
   void setParameters(const ParameterData& p);
 
+  /**
+   * @return estimated number of bytes allocated by this object, not including the object itself
+   */
+  int memoryUsage() const;
+
   std::string toString() const;
 
   std::string toPVS() const;
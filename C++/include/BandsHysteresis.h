@@ -80,6 +80,27 @@ public:
 
   std::string toString() const;
 
+  /*
+   * Write internal state of this object into buf
+   */
+  void writeState(StateBuffer& buf) const;
+
+  /*
+   * Read internal state of this object from buf. Return false if buf has an error.
+   */
+  bool readState(StateBuffer& buf);
+
+  /*
+   * @return estimated number of bytes allocated by this object, not including the object itself
+   */
+  int memoryUsage() const;
+
+  /*
+   * If this object would be reset at current_time (see resetIfCurrentTime), reset it and release the
+   * memory of its M of N values. Return true if the object was reset.
+   */
+  bool trimIfExpired(double current_time);
+
   virtual ~BandsHysteresis() {}
 
 private:
@@ -30,6 +30,8 @@ public:
   bool same_colors() const;
   std::string toString() const;
   static std::string listToString(const std::vector<BandsMofN>& l);
+  void writeState(StateBuffer& buf) const;
+  bool readState(StateBuffer& buf);
 
   virtual ~BandsMofN() {}
 
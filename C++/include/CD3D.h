@@ -115,6 +115,32 @@ public:
    */
   static LossData detectionActual(const Vect3& s, const Vect3& vo, const Vect3& vi, const double D, const double H);
 
+  /**
+   * Computes the unbounded time interval where the aircraft are horizontally within distance D.
+   * The actual conflict times (see detectionActual) are the intersection of this interval and
+   * verticalLossInterval (see Detection3D::separableLossInterval).
+   * 
+   * @param s the relative horizontal position of the aircraft
+   * @param vo the ownship's horizontal velocity
+   * @param vi the intruder's horizontal velocity
+   * @param D the minimum horizontal distance
+   * 
+   * @return horizontal time interval, which may be empty
+   */
+  static Interval horizontalLossInterval(const Vect2& s, const Vect2& vo, const Vect2& vi, const double D);
+
+  /**
+   * Computes the unbounded time interval where the aircraft are vertically within distance H.
+   * 
+   * @param sz the relative vertical position of the aircraft
+   * @param voz the ownship's vertical speed
+   * @param viz the intruder's vertical speed
+   * @param H the minimum vertical distance
+   * 
+   * @return vertical time interval, which may be empty
+   */
+  static Interval verticalLossInterval(const double sz, const double voz, const double viz, const double H);
+
   /**
    * Determines if there is a conflict in the time interval [B,T]
    * 
@@ -181,6 +181,13 @@ public:
   virtual ConflictData conflictDetection(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi, double B, double T) const;
   double timeOfClosestApproach(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi, double B, double T) const;
 
+  // The cylinder has an interval form: the loss interval is computed by CD3D::detectionActual
+  virtual bool hasLossInterval() const;
+  virtual LossData lossInterval(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi) const;
+  virtual bool hasVerticalInterval() const;
+  virtual Interval verticalInterval(double sz, double voz, double viz, double B, double T) const;
+  virtual Interval horizontalInterval(const Vect2& s, const Vect2& vo, const Vect2& vi) const;
+
   /** This returns a pointer to a new instance of this type of Detector3D.  You are responsible for destroying this instance when it is no longer needed. */
   virtual CDCylinder* copy() const;
   virtual CDCylinder* make() const;
@@ -27,6 +27,11 @@ public:
    * Return -1 if no aircraft is most urgent.
    */
   int mostUrgentAircraft(const TrafficState& ownship, const std::vector<TrafficState>& traffic, double T) const;
+
+  /**
+   * Same as above, but scanning the relative states in table
+   */
+  int mostUrgentAircraft(const TrafficState& ownship, const std::vector<TrafficState>& traffic, const TrafficTable& table, double T) const;
   UrgencyStrategy* copy() const;
 };
 
@@ -22,11 +22,17 @@
 #include "Alerter.h"
 #include "Detection3D.h"
 #include "IndexLevelT.h"
+#include "EncounterMetricsTable.h"
+#include "DaidalusResult.h"
+#include "Executor.h"
+#include "MemoryUsage.h"
 #include "string_util.h"
 #include "format.h"
 #include <vector>
 #include <string>
+#include <iostream>
 #include <cmath>
+#include <memory>
 
 namespace larcfm {
 
@@ -99,6 +105,8 @@ private:
   DaidalusHsBands   hs_band_;
   DaidalusVsBands   vs_band_;
   DaidalusAltBands  alt_band_;
+  // Last published result. It is only accessed through std::atomic_load and std::atomic_store
+  std::shared_ptr<const DaidalusResult> published_;
 
   void stale_bands();
 
@@ -471,6 +479,98 @@ public:
    */
   TrafficState mostUrgentAircraft();
 
+  /* Executor of parallel computations */
+
+  /**
+   * @return executor used for parallel computations, which is Executor::defaultExecutor() unless
+   * one has been set.
+   */
+  Executor& getExecutor() const;
+
+  /**
+   * Set executor used for parallel computations, e.g., an adapter to the thread pool of the application
+   * or a SerialExecutor. The executor is not copied and it must outlive this object.
+   */
+  void setExecutor(Executor& executor);
+
+  /* Concurrent computation of recovery bands */
+
+  /**
+   * @return maximum number of recovery cylinder sizes evaluated concurrently.
+   */
+  int getRecoveryThreads() const;
+
+  /**
+   * Set maximum number of recovery cylinder sizes evaluated concurrently by the executor when
+   * collision avoidance bands are enabled. A value of 1, which is the default, means that cylinder 
+   * sizes are evaluated one at a time. In either case, recovery bands are the same.
+   */
+  void setRecoveryThreads(int threads);
+
+  /* Closed-form computation of instantaneous vertical speed bands */
+
+  /**
+   * @return mode of computation of instantaneous vertical speed bands for cylinders: 0 (sampled), 
+   * 1 (closed form), or 2 (closed form, cross-checked against sampled bands).
+   */
+  int getAnalyticVerticalSpeedBands() const;
+
+  /**
+   * Set mode of computation of instantaneous vertical speed bands when detectors are cylinders: 
+   * 0 means that every vertical speed step is checked for conflict, 1, which is the default, means that 
+   * conflict vertical speeds are computed in closed form, and 2 means that closed form bands are compared 
+   * to sampled ones and, in case of disagreement, sampled bands are used.
+   */
+  void setAnalyticVerticalSpeedBands(int mode);
+
+  /**
+   * @return number of times closed form and sampled vertical speed bands have disagreed since the 
+   * mode was last set, when mode is 2.
+   */
+  int analyticVerticalSpeedBandsMismatches() const;
+
+  /* Memory footprint */
+
+  /**
+   * @return estimated memory footprint of this object, in bytes, by component
+   */
+  MemoryUsage memoryUsage() const;
+
+  /**
+   * @return memory budget in bytes. 0 means no budget.
+   */
+  int getMemoryBudget() const;
+
+  /**
+   * Set memory budget in bytes. When an ownship state is set and the estimated memory footprint of this
+   * object exceeds the budget, memory is trimmed (see trimMemory). A value of 0, which is the default, means
+   * no budget. The budget is not a hard limit, since information that may affect outputs is always kept.
+   */
+  void setMemoryBudget(int bytes);
+
+  /**
+   * Release memory of stale cached values, e.g., bands and conflict aircraft of previous time steps, and remove
+   * hysteresis information that would be reset at current time, e.g., of aircraft that are no longer in the
+   * traffic list. Outputs are not affected.
+   */
+  void trimMemory();
+
+  /* Publication of results for concurrent readers */
+
+  /**
+   * Computes all bands, resolutions, and alerts for the current time step and atomically
+   * publishes them as an immutable snapshot, which replaces the previously published one.
+   * @return the published snapshot
+   */
+  std::shared_ptr<const DaidalusResult> publishResult();
+
+  /**
+   * @return last snapshot published by publishResult, or a null pointer if none has been published.
+   * This method can be called from any thread, even while this object is computing the next time step.
+   * The returned snapshot remains valid as long as the caller holds it.
+   */
+  std::shared_ptr<const DaidalusResult> latestResult() const;
+
   /* Computation of contours, a.k.a. blobs, and hazard zones */
 
   /**
@@ -1895,6 +1995,18 @@ public:
    */
   bool saveToFile(const std::string& file);
 
+  /**
+   *  Write parameters to binary file. If source is not empty, a hash of the source configuration
+   *  file is stored to detect stale binary files.
+   */
+  bool saveCompiled(const std::string& file, const std::string& source="");
+
+  /**
+   *  Load parameters from binary file written by saveCompiled. If source is not empty, parameters
+   *  are loaded only if they were compiled from the current contents of the source configuration file.
+   */
+  bool loadCompiled(const std::string& file, const std::string& source="");
+
   /**
    * Set bands parameters
    */
@@ -1936,6 +2048,23 @@ public:
    */
   void clearHysteresis();
 
+  /**
+   * Write in state a compact binary representation of the runtime state of this object, i.e., ownship
+   * and traffic states, wind, current time, and alerting, DTA, and bands hysteresis information
+   * (M of N windows and persistence). Configuration parameters, urgency strategy, and cached values are not
+   * written. Previous contents of state are replaced, but its allocated memory is reused.
+   * The representation depends on the architecture of the host and on the version of DAIDALUS.
+   */
+  void serializeState(std::string& state) const;
+
+  /**
+   * Restore runtime state written by serializeState, possibly by another Daidalus object.
+   * The configuration of this object is expected to be the same as the one of the object that
+   * wrote the state. Return false if state is not valid, in which case ownship, traffic, and hysteresis
+   * information are cleared.
+   */
+  bool restoreState(const std::string& state);
+
   /**
    *  Clear ownship and traffic state data from this object.
    *  IMPORTANT: This method reset cache and hysteresis parameters.
@@ -2796,6 +2925,20 @@ public:
    */
   double modifiedTau(int ac_idx, double DMOD, const std::string& DMODu, const std::string& u) const;
 
+  /**
+   * Returns DAA performance metrics, in internal units, with aircraft at index ac_idx, including time to 
+   * violation of alert thresholds of every alert level of its alerter. Metrics are computed at most once 
+   * per cycle. The returned reference is valid until the state of this object changes.
+   * Returns invalid metrics if aircraft index is not valid
+   */
+  const EncounterMetrics& encounterMetrics(int ac_idx);
+
+  /**
+   * Put in table the DAA performance metrics, in internal units, of all traffic aircraft, where 
+   * the i-th row corresponds to the aircraft at index i+1.
+   */
+  void encounterMetrics(EncounterMetricsTable& table);
+
   /* Input/Output methods */
 
   std::string outputStringAircraftStates(bool header=true) const;
@@ -2804,6 +2947,12 @@ public:
 
   std::string toString() const;
 
+  /**
+   * Write toString() to output stream. Output is written incrementally, i.e., without building
+   * an intermediate string for the whole object.
+   */
+  void toString(std::ostream& out) const;
+
   std::string outputStringInfo();
 
   std::string outputStringAlerting();
@@ -2820,8 +2969,19 @@ public:
 
   std::string outputString();
 
+  /**
+   * Write outputString() to output stream, one section at a time.
+   */
+  void outputString(std::ostream& out);
+
   std::string toPVS(bool parameters);
 
+  /**
+   * Write toPVS(parameters) to output stream. Output is written incrementally, i.e., without building
+   * an intermediate string for the whole time step.
+   */
+  void toPVS(std::ostream& out, bool parameters);
+
   std::string toPVS();
 
   // ErrorReporter Interface Methods
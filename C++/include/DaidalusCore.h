@@ -18,6 +18,11 @@
 #include "TrafficState.h"
 #include "DaidalusParameters.h"
 #include "SpecialBandFlags.h"
+#include "EncounterMetrics.h"
+#include "TrafficTable.h"
+#include "StateBuffer.h"
+#include "Executor.h"
+#include "MemoryUsage.h"
 #include <map>
 #include <vector>
 #include <string>
@@ -43,6 +48,12 @@ public:
   DaidalusParameters parameters;
   /* Strategy for most urgent aircraft */
   std::unique_ptr<UrgencyStrategy> urgency_strategy;
+  /* Maximum number of threads used to evaluate recovery cylinder sizes concurrently (1 means serial) */
+  int recovery_threads;
+  /* Executor used for parallel computations, which is owned by the application. NULL means Executor::defaultExecutor() */
+  Executor* executor;
+  /* Estimated memory, in bytes, above which caches and expired hysteresis are trimmed when new ownship states are set. 0 means no budget */
+  int memory_budget;
 
   private:
   /**** CACHED VARIABLES ****/
@@ -69,6 +80,13 @@ public:
    * NaN means that bands are not computed for that region
    */
   bool bands4region_[BandsRegion::NUMBER_OF_CONFLICT_BANDS];
+  /* 
+   * Cached conflict detections per conflict bands computed by conflict_aircraft, where the i-th element
+   * corresponds to the i-th aircraft in the traffic list. A detection is only available if the corresponding 
+   * element in conflict_data_ready_ is true.
+   */
+  std::vector<ConflictData> conflict_data_[BandsRegion::NUMBER_OF_CONFLICT_BANDS];
+  std::vector<bool> conflict_data_ready_[BandsRegion::NUMBER_OF_CONFLICT_BANDS];
 
   /**** HYSTERESIS VARIABLES ****/
 
@@ -77,6 +95,30 @@ public:
   std::map<std::string,HysteresisData> dta_hysteresis_acs_;
   HysteresisData below_min_as_hysteresis_; // Below min airspeed Hysteris
 
+  /* 
+   * Cached DTA values for the current cycle, where 0th is the ownship and (i+1)th is the i-th aircraft
+   * in the traffic list. A negative value means that the value has not been computed.
+   */
+  std::vector<int> dta_acs_;
+  /* 
+   * Cached DTA center in the ownship Euclidean frame. The status is negative if the center hasn't been 
+   * computed, 0 if the projected center cannot be used, and 1 otherwise.
+   */
+  int dta_center_status_;
+  Vect2 dta_center_;
+  /* 
+   * Cached encounter metrics for the current cycle, where the i-th element corresponds to the i-th aircraft
+   * in the traffic list. Metrics are only available if the corresponding element in encounter_metrics_ready_ is true.
+   */
+  std::vector<EncounterMetrics> encounter_metrics_;
+  std::vector<bool> encounter_metrics_ready_;
+  /*
+   * Cached states of traffic aircraft relative to the ownship for the current cycle.
+   * The table is only available if traffic_table_ready_ is true.
+   */
+  TrafficTable traffic_table_;
+  bool traffic_table_ready_;
+
   void copyFrom(const DaidalusCore& core);
   void refresh_mua_eps();
 
@@ -114,6 +156,35 @@ public:
    */
   void clear_hysteresis();
 
+  /**
+   * Write into buf ownship and traffic states, wind, current time, and hysteresis information
+   * of this object. Parameters and cached values are not written.
+   */
+  void write_state(StateBuffer& buf) const;
+
+  /**
+   * Read from buf information written by write_state. Return false, without modifying
+   * this object, if buf has an error.
+   */
+  bool read_state(StateBuffer& buf);
+
+  /**
+   * Add estimated memory allocated by this object to usage
+   */
+  void memory_usage(MemoryUsage& usage) const;
+
+  /**
+   * Release memory of cached values that are stale and remove hysteresis information of aircraft
+   * that would be reset at current time. Alerting hysteresis with a positive alert level is kept, since it
+   * selects early alerting times. Computed values are not affected.
+   */
+  void trim_memory();
+
+  /**
+   * @return executor used for parallel computations
+   */
+  Executor& getExecutor() const;
+
   /**
    * Set cached values to stale conditions as they are no longer fresh.
    */
@@ -235,9 +306,21 @@ public:
 
 private:
 
-  int dta_hysteresis_current_value(const TrafficState& ac);
+  int dta_hysteresis_current_value(const TrafficState& ac, bool projected);
+
+  // idx is a 0-based index in the traffic list, -1 is the ownship
+  int dta_hysteresis_current_value(int idx);
+
+  /**
+   * Return true if aircraft is within the DTA cylinder. If projected is true, ac is either the ownship or an
+   * aircraft in the traffic list, and the containment check is first attempted in the ownship Euclidean frame.
+   */
+  bool dta_contains(const TrafficState& ac, bool projected);
 
-  int alerting_hysteresis_current_value(const TrafficState& intruder, int turning, int accelerating, int climbing);
+  bool refresh_dta_center();
+
+  // idx is a 0-based index in the traffic list
+  int alerting_hysteresis_current_value(int idx, int turning, int accelerating, int climbing);
 
   bool greater_than_corrective() const;
 
@@ -272,6 +355,29 @@ public:
    */
   const Interval& tiov(int conflict_region);
 
+  /**
+   * Requires 0 <= conflict_region < CONFICT_BANDS and idx is a 0-based index in the traffic list
+   * Put in det the conflict detection, between 0 and lookahead time, of the idx-th aircraft using the
+   * detector of the alert level for the given conflict region. Return false if the detection was not computed 
+   * in the current cycle, e.g., the aircraft doesn't have an alert level for that region.
+   * INTERNAL USE ONLY
+   */
+  bool conflict_detection(ConflictData& det, int conflict_region, int idx);
+
+  /**
+   * Requires idx is a 0-based index in the traffic list
+   * @return encounter metrics of the idx-th aircraft. Metrics are computed at most once per cycle
+   * and violations of alert thresholds reuse the conflict detections computed for conflict bands.
+   * INTERNAL USE ONLY
+   */
+  const EncounterMetrics& encounter_metrics(int idx);
+
+  /**
+   * @return states of traffic aircraft relative to the ownship. The table is built at most once per cycle.
+   * INTERNAL USE ONLY
+   */
+  const TrafficTable& traffic_table();
+
   /**
    * Return alert index used for intruder aircraft.
    * The alert index depends on alerting logic and DTA logic.
@@ -282,6 +388,12 @@ public:
    */
   int alerter_index_of(const TrafficState& intruder);
 
+  /**
+   * Return alert index used for the idx-th aircraft in the traffic list (0-based index), where
+   * -1 refers to the ownship. The DTA status used to compute this value is cached for the current cycle.
+   */
+  int alerter_index_of(int idx);
+
   static int epsilonH(const TrafficState& ownship, const TrafficState& ac);
 
   static int epsilonV(const TrafficState& ownship, const TrafficState& ac);
@@ -19,6 +19,8 @@
 
 #include <vector>
 #include <string>
+#include <map>
+#include <tuple>
 #include "TrafficState.h"
 
 namespace larcfm {
@@ -28,7 +30,138 @@ class DaidalusIntegerBands {
 
   // This class computes NONE bands
 
+private:
+  /*
+   * Key of a trajectory sample: detector, traffic aircraft, trajdir, time, target_step, and instantaneous flag.
+   * Traffic aircraft are identified by address, which is stable while the cache is enabled since they are
+   * elements of the traffic list of the core.
+   */
+  typedef std::tuple<const Detection3D*,const TrafficState*,bool,double,int,bool> SampleKey;
+  typedef std::tuple<SampleKey,double,double> ConflictKey;
+
+
+  /*
+   * Key of a vertical interval: detector, traffic aircraft, and detection times B and T (0 for detectors
+   * with a loss interval). For detectors that have a vertical interval, the vertical interval of the last 
+   * vertical state (sz,voz,viz) seen for a key is cached. Horizontal maneuvers do not change the vertical
+   * state, so the vertical interval is computed once and only the horizontal component is computed per sample.
+   */
+  typedef std::tuple<const Detection3D*,const TrafficState*,double,double> VerticalKey;
+  class VerticalEntry {
+  public:
+    double sz;
+    double voz;
+    double viz;
+    Interval ii;
+    VerticalEntry(double z, double vo, double vi, const Interval& i) : sz(z), voz(vo), viz(vi), ii(i) {}
+  };
+
+  /*
+   * Key of a horizontal interval: detector and traffic aircraft. For detectors that have both a vertical 
+   * interval and a loss interval, the horizontal interval of the last horizontal state (s,vo,vi) seen for 
+   * a key is cached. Vertical maneuvers do not change the horizontal state.
+   */
+  typedef std::pair<const Detection3D*,const TrafficState*> HorizontalKey;
+  class HorizontalEntry {
+  public:
+    Vect2 s;
+    Vect2 vo;
+    Vect2 vi;
+    Interval ii;
+    HorizontalEntry(const Vect2& s2, const Vect2& vo2, const Vect2& vi2, const Interval& i) : s(s2), vo(vo2), vi(vi2), ii(i) {}
+  };
+
+  /* 
+   * When enabled, loss intervals per trajectory sample are cached for detectors with an interval form.
+   * For other detectors, conflict answers per trajectory sample and detection times are cached.
+   */
+  class SampleCache {
+  public:
+    std::map<SampleKey,LossData> loss_intervals;
+    std::map<ConflictKey,bool> conflicts;
+    std::map<VerticalKey,VerticalEntry> vertical_intervals;
+    std::map<HorizontalKey,HorizontalEntry> horizontal_intervals;
+    void clear();
+    void forget(const Detection3D& det);
+  };
+  mutable bool loss_intervals_enabled_;
+  mutable SampleCache cache_;
+
+  // Cache used by the current thread instead of cache_, if not null (see PrivateCacheScope)
+  static thread_local SampleCache* thread_cache_;
+
+  SampleCache& sample_cache() const {
+    return thread_cache_ != NULL ? *thread_cache_ : cache_;
+  }
+
+  // Return cached vertical interval for given key and vertical state
+  const Interval& vertical_interval(const Detection3D& det, const TrafficState& traffic, double sz, double voz, double viz,
+      double B, double T) const;
+
+  /*
+   * Return det.conflictDetectionWithTrafficState(own,traffic,B,T) for a detector that has a vertical 
+   * interval, but not a loss interval, reusing the cached vertical interval when the vertical state is unchanged.
+   */
+  LossData separable_detection(const Detection3D& det, const TrafficState& own, const TrafficState& traffic,
+      double B, double T) const;
+
+  /*
+   * Return det.lossIntervalWithTrafficState(own,traffic) for a detector that has a vertical interval and
+   * a loss interval, reusing the cached vertical and horizontal intervals when the corresponding states are 
+   * unchanged.
+   */
+  LossData separable_loss_interval(const Detection3D& det, const TrafficState& own, const TrafficState& traffic) const;
+
+  /*
+   * Return det.conflictWithTrafficState(own,traffic,B,T), where own is the ownship state at the
+   * given trajectory sample. The answer is derived from the cached loss interval of the sample, when
+   * available.
+   */
+  bool conflict_at_sample(const Detection3D& det, const TrafficState& own, const TrafficState& traffic,
+      double B, double T, bool trajdir, double tsk, int target_step, bool instantaneous) const;
+
+protected:
+  /*
+   * Enable the cache of loss intervals. The cache assumes that the ownship and traffic states are fixed
+   * until the cache is disabled, e.g., during a refresh of the bands.
+   */
+  void enable_loss_intervals();
+
+  /*
+   * Disable and clear the cache of loss intervals.
+   */
+  void disable_loss_intervals();
+
+  /*
+   * Remove cached loss intervals of given detector. This method has to be called when a
+   * detector object is modified while the cache is enabled.
+   */
+  void forget_loss_intervals(const Detection3D& det);
+
+  /*
+   * Return estimated number of bytes allocated by the cache of loss intervals of this object
+   */
+  int loss_intervals_memory_usage() const;
+
+  /*
+   * While an object of this class is in scope, the current thread uses its own cache of loss intervals. 
+   * This enables several threads to compute bands of the same object concurrently, provided that 
+   * each one of them has a PrivateCacheScope.
+   */
+  class PrivateCacheScope {
+  private:
+    SampleCache cache_;
+    SampleCache* previous_;
+    PrivateCacheScope(const PrivateCacheScope&);
+    PrivateCacheScope& operator=(const PrivateCacheScope&);
+  public:
+    PrivateCacheScope() : previous_(thread_cache_) { thread_cache_ = &cache_; }
+    ~PrivateCacheScope() { thread_cache_ = previous_; }
+  };
+
 public:
+  DaidalusIntegerBands() : loss_intervals_enabled_(false) {}
+
   // trajdir == false is left/down
   // target_step is used by instantaneous_bands and altitude_bands
   virtual std::pair<Vect3,Vect3> trajectory(const DaidalusParameters& parameters, const TrafficState& ownship,
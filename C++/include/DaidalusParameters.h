@@ -24,6 +24,24 @@ private:
 
   std::vector<Alerter> alerters_;
 
+  /*
+   * Compiled alerting plan. For the i-th alerter (0-based) and conflict region r, where 0:NEAR, 1:MID, 2:FAR,
+   * the entry at i*NUMBER_OF_CONFLICT_BANDS+r contains the alert level for that region (-1 if none), and its
+   * alerting and early alerting times. The plan is compiled every time the list of alerters changes.
+   */
+  class AlertingPlanEntry {
+  public:
+    int level;
+    double alerting_time;
+    double early_alerting_time;
+    AlertingPlanEntry(int l, double at, double eat) : level(l), alerting_time(at), early_alerting_time(eat) {}
+  };
+  std::vector<AlertingPlanEntry> alerting_plan_;
+  // True if some alerter has an alert level for the given conflict region
+  bool alerting_plan_regions_[BandsRegion::NUMBER_OF_CONFLICT_BANDS];
+
+  void compile_alerting_plan();
+
   ErrorLog error;
 
   // Bands
@@ -952,6 +970,31 @@ public:
    */
   int correctiveAlertLevel(int alerter_idx);
 
+  /**
+   * @param alerter_idx Indice of an alerter (starting from 1)
+   * @param conflict_region Conflict region, where 0:NEAR, 1:MID, 2:FAR
+   * @return alert level of alerter at alerter_idx for given conflict region. Return -1 if alerter_idx
+   * is out of range or if there is no alert level for that region. This method is equivalent to
+   * getAlerterAt(alerter_idx).alertLevelForRegion(BandsRegion::regionFromOrder(NUMBER_OF_CONFLICT_BANDS-conflict_region)),
+   * but it uses the compiled alerting plan.
+   */
+  int alertLevelForConflictRegion(int alerter_idx, int conflict_region) const;
+
+  /**
+   * @param alerter_idx Indice of an alerter (starting from 1)
+   * @param conflict_region Conflict region, where 0:NEAR, 1:MID, 2:FAR
+   * @param early If true, returns early alerting time. Otherwise, returns alerting time.
+   * @return (early) alerting time of the alert level of alerter at alerter_idx for given conflict region.
+   * Return NaN if there is no such alert level.
+   */
+  double alertingTimeForConflictRegion(int alerter_idx, int conflict_region, bool early) const;
+
+  /**
+   * @param conflict_region Conflict region, where 0:NEAR, 1:MID, 2:FAR
+   * @return true if some alerter has an alert level for given conflict region.
+   */
+  bool hasAlertLevelForConflictRegion(int conflict_region) const;
+
   /**
    * @return maximum number of alert levels for all alerters. Returns 0 if alerter list is empty.
    */
@@ -981,6 +1024,26 @@ public:
    */
   bool saveToFile(const std::string& file);
 
+  /**
+   * Write fully resolved parameters, including alerters and detectors, in internal units to a binary file.
+   * If source is not empty, a hash of the contents of the source configuration file is stored in the binary
+   * file so that loadCompiled can check that the binary file is not stale.
+   */
+  bool saveCompiled(const std::string& file, const std::string& source="");
+
+  /**
+   * Load parameters from a binary file written by saveCompiled. No text parsing is performed. If source
+   * is not empty, the parameters are loaded only if the contents of the source configuration file match
+   * the hash stored in the binary file.
+   */
+  bool loadCompiled(const std::string& file, const std::string& source="");
+
+  /**
+   * @return estimated number of bytes allocated by this object, including alerters and detectors,
+   * but not the object itself
+   */
+  int memoryUsage() const;
+
   std::string toString() const;
 
   std::string toPVS() const;
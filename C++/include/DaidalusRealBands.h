@@ -10,6 +10,7 @@
 #include "Velocity.h"
 #include "Position.h"
 #include "Detection3D.h"
+#include "CDCylinder.h"
 #include "Integerval.h"
 #include "IntervalSet.h"
 #include "BandsRange.h"
@@ -25,6 +26,7 @@
 
 #include <vector>
 #include <string>
+#include <iostream>
 
 #include "ColorValue.h"
 #include "TrafficState.h"
@@ -163,6 +165,28 @@ public:
    */
   void clear_hysteresis();
 
+  /**
+   * Write hysteresis information into buf
+   */
+  void write_state(StateBuffer& buf) const;
+
+  /**
+   * Read from buf information written by write_state. Return false, without modifying
+   * this object, if buf has an error.
+   */
+  bool read_state(StateBuffer& buf);
+
+  /**
+   * Add estimated memory allocated by this object to usage
+   */
+  void memory_usage(MemoryUsage& usage) const;
+
+  /**
+   * Release memory of cached values, if they are stale, and of hysteresis information, if it would be
+   * reset at current_time. Computed values are not affected.
+   */
+  void trim_memory(double current_time);
+
   /**
    * Returns true is object is fresh
    */
@@ -236,6 +260,25 @@ private:
   bool compute_recovery_bands(IntervalSet& none_set_region, const std::vector<IndexLevelT>& ilts,
       DaidalusCore& core);
 
+  /**
+   * Compute recovery bands in none_set_region for the recovery cylinder cd3d. Return true if
+   * recovery bands are not saturated. In this case, recovery_time is set.
+   */
+  bool recovery_bands_for(IntervalSet& none_set_region, const std::vector<IndexLevelT>& ilts,
+      const CDCylinder& cd3d, double& recovery_time, DaidalusCore& core);
+
+  // Task of recovery_bands_for for the k-th cylinder, found[k] is set to 1 if recovery bands are not saturated
+  void recovery_bands_task(int k, std::vector<IntervalSet>& none_sets, const std::vector<IndexLevelT>& ilts,
+      const std::vector<CDCylinder>& cylinders, std::vector<double>& recovery_times, std::vector<int>& found, DaidalusCore& core);
+
+  /**
+   * Same as the loop of compute_recovery_bands that reduces the recovery cylinder cd3d, but
+   * several cylinder sizes, up to core.recovery_threads, are evaluated concurrently by the executor of core.
+   * Requires collision avoidance bands to be enabled.
+   */
+  bool compute_recovery_bands_concurrently(IntervalSet& none_set_region, const std::vector<IndexLevelT>& ilts,
+      const CDCylinder& cd3d, DaidalusCore& core);
+
   /**
    * Requires: compute_bands(conflict_region) = true && 0 <= conflict_region < CONFLICT_BANDS
    * Compute bands for one region. Return true iff recovery bands were computed.
@@ -280,11 +323,12 @@ public:
    */
   double last_time_to_maneuver(DaidalusCore& core, const TrafficState& intruder);
 
-private:
+protected:
   int maxdown(const DaidalusParameters& parameters, const TrafficState& ownship) const;
 
   int maxup(const DaidalusParameters& parameters, const TrafficState& ownship) const;
 
+private:
   /** Add (lb,ub) to noneset. In the case of mod_ > 0, lb can be greater than ub. This function takes
    * care of the mod logic. This function doesn't do anything when lb and ub are almost equals.
    * @param noneset: Interval set where (lb,ub) will be added
@@ -324,8 +368,18 @@ public:
 
   std::string toString() const;
 
+  /**
+   * Write toString() to output stream without building an intermediate string
+   */
+  void toString(std::ostream& out) const;
+
   std::string toPVS() const;
 
+  /**
+   * Write toPVS() to output stream without building an intermediate string
+   */
+  void toPVS(std::ostream& out) const;
+
 };
 
 }
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef DAIDALUSRESULT_H_
+#define DAIDALUSRESULT_H_
+
+#include "TrafficState.h"
+#include "BandsRange.h"
+#include "BandsRegion.h"
+#include "Interval.h"
+#include "RecoveryInformation.h"
+#include <vector>
+#include <string>
+
+namespace larcfm {
+
+class Daidalus;
+
+/**
+ * Immutable snapshot of the alerting and banding information computed by a Daidalus object
+ * for one time step. All values are materialized when the snapshot is created, so that its
+ * methods, which are all const, can be called from several threads without synchronization.
+ * Methods have the same meaning as the corresponding ones in Daidalus. Values are in internal units.
+ * Snapshots are usually obtained through Daidalus::publishResult and Daidalus::latestResult.
+ */
+class DaidalusResult {
+
+private:
+  static const int DIRECTION = 0;
+  static const int HORIZONTAL_SPEED = 1;
+  static const int VERTICAL_SPEED = 2;
+  static const int ALTITUDE = 3;
+  static const int DIMENSIONS = 4;
+
+  double current_time_;
+  TrafficState ownship_;
+  std::vector<TrafficState> traffic_;
+  // Alert level of the i-th aircraft in the traffic list
+  std::vector<int> alert_levels_;
+  // Bands, resolutions (0: down/left, 1: up/right), preferred direction, and recovery information per dimension
+  std::vector<BandsRange> ranges_[DIMENSIONS];
+  double resolution_[DIMENSIONS][2];
+  bool preferred_[DIMENSIONS];
+  std::vector<RecoveryInformation> recovery_;
+
+  int bandsLength(int dim) const;
+  Interval intervalAt(int dim, int i) const;
+  BandsRegion::Region regionAt(int dim, int i) const;
+  double resolution(int dim, bool dir) const;
+
+public:
+
+  /**
+   * Computes all bands, resolutions, and alerts of daa for its current time step.
+   */
+  explicit DaidalusResult(Daidalus& daa);
+
+  double getCurrentTime() const;
+
+  const TrafficState& getOwnshipState() const;
+
+  /**
+   * @return the index of the last traffic aircraft. The index of the first aircraft is 1.
+   */
+  int lastTrafficIndex() const;
+
+  /**
+   * @return state of the aircraft at index idx (0 is the ownship), or INVALID if index is out of range
+   */
+  const TrafficState& getAircraftStateAt(int idx) const;
+
+  /**
+   * @return alert level of aircraft at index ac_idx, or -1 if index is out of range
+   */
+  int alertLevel(int ac_idx) const;
+
+  int horizontalDirectionBandsLength() const;
+  Interval horizontalDirectionIntervalAt(int i) const;
+  BandsRegion::Region horizontalDirectionRegionAt(int i) const;
+  double horizontalDirectionResolution(bool dir) const;
+  bool preferredHorizontalDirectionRightOrLeft() const;
+  const RecoveryInformation& horizontalDirectionRecoveryInformation() const;
+
+  int horizontalSpeedBandsLength() const;
+  Interval horizontalSpeedIntervalAt(int i) const;
+  BandsRegion::Region horizontalSpeedRegionAt(int i) const;
+  double horizontalSpeedResolution(bool dir) const;
+  bool preferredHorizontalSpeedUpOrDown() const;
+  const RecoveryInformation& horizontalSpeedRecoveryInformation() const;
+
+  int verticalSpeedBandsLength() const;
+  Interval verticalSpeedIntervalAt(int i) const;
+  BandsRegion::Region verticalSpeedRegionAt(int i) const;
+  double verticalSpeedResolution(bool dir) const;
+  bool preferredVerticalSpeedUpOrDown() const;
+  const RecoveryInformation& verticalSpeedRecoveryInformation() const;
+
+  int altitudeBandsLength() const;
+  Interval altitudeIntervalAt(int i) const;
+  BandsRegion::Region altitudeRegionAt(int i) const;
+  double altitudeResolution(bool dir) const;
+  bool preferredAltitudeUpOrDown() const;
+  const RecoveryInformation& altitudeRecoveryInformation() const;
+
+  std::string toString() const;
+
+};
+
+}
+
+#endif
@@ -12,20 +12,64 @@
 #include "Detection3D.h"
 #include "DaidalusRealBands.h"
 #include "IntervalSet.h"
+#include "Integerval.h"
 #include "Tuple5.h"
 #include "Kinematics.h"
 #include "ProjectedKinematics.h"
 #include <vector>
+#include <atomic>
 
 namespace larcfm {
 
 class DaidalusVsBands : public DaidalusRealBands {
 
+private:
+  /* 
+   * Computation of instantaneous bands when detectors are cylinders: 0 samples every vertical speed step, 
+   * 1 derives conflict vertical speeds in closed form, 2 does both and keeps the sampled bands 
+   */
+  int analytic_;
+  /* Number of closed-form computations that differ from sampled ones when analytic_ is 2 */
+  mutable std::atomic<int> mismatches_;
+
+  // Return true if instantaneous bands for the given detectors can be computed in closed form
+  bool analytic_bands(const Detection3D& conflict_det, const Detection3D& recovery_det,
+      int epsh, int epsv, const DaidalusParameters& parameters) const;
+
+  /*
+   * Range [ka,kb] of steps, in direction dir, where the instantaneous vertical speed maneuver is in conflict 
+   * with traffic for cylinder det in [B,T]. The range is empty when ka > kb. The bounds of the range are 
+   * estimated in closed form and then checked, as well as their neighbors, using sampled detection.
+   */
+  void conflict_steps(int& ka, int& kb, const Detection3D& det, double B, double T, bool dir, int max,
+      const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const;
+
+  // Same as instantaneous_bands for cylinders, i.e., list of conflict free steps in direction dir
+  void analytic_instantaneous_bands(std::vector<Integerval>& l, const Detection3D& conflict_det, const Detection3D& recovery_det,
+      double B, double T, bool dir, int max,
+      const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const;
+
 public:
   DaidalusVsBands();
 
   DaidalusVsBands(const DaidalusVsBands& b);
 
+  DaidalusVsBands& operator=(const DaidalusVsBands& b);
+
+  /**
+   * Set computation of instantaneous vertical speed bands when detectors are cylinders: 0 samples every 
+   * vertical speed step, 1 derives conflict vertical speeds per aircraft in closed form, 2 does both and 
+   * keeps the sampled bands, counting the differences.
+   */
+  void set_analytic(int mode);
+
+  int get_analytic() const;
+
+  /**
+   * Number of times closed-form and sampled bands differ. Only counted when analytic mode is 2.
+   */
+  int analytic_mismatches() const;
+
   virtual bool do_recovery(const DaidalusParameters& parameters) const;
 
   virtual double get_step(const DaidalusParameters& parameters) const;
@@ -54,6 +98,9 @@ public:
 
   virtual double max_delta_resolution(const DaidalusParameters& parameters) const;
 
+  virtual void none_bands(IntervalSet& noneset, const Detection3D& conflict_det, const Detection3D& recovery_det,
+      int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const;
+
 };
 
 }
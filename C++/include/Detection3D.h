@@ -15,6 +15,7 @@
 #define DETECTION3D_H_
 
 #include "Vect3.h"
+#include "Interval.h"
 #include "ParameterData.h"
 #include "TrafficState.h"
 #include "ConflictData.h"
@@ -105,6 +106,87 @@ public:
    */
   virtual ConflictData conflictDetectionWithTrafficState(const TrafficState& ownship, const TrafficState& intruder, double B, double T) const;
 
+  /**
+   * Returns true if this detector has an interval form, i.e., for a linear relative state, the times of loss
+   * of separation form a single interval that can be computed once by lossInterval. In this case,
+   * conflict(so,vo,si,vi,B,T) is equivalent to lossInterval(so,vo,si,vi).conflictBetween(B,T) for any B and T.
+   */
+  virtual bool hasLossInterval() const;
+
+  /**
+   * Returns the unbounded interval of loss of separation, i.e., the interval is not cut at any lookahead time.
+   * This method is only meaningful when hasLossInterval() is true. Otherwise, it returns an empty interval.
+   * @param so  ownship position
+   * @param vo  ownship velocity
+   * @param si  intruder position
+   * @param vi  intruder velocity
+   * @return unbounded interval of loss of separation
+   */
+  virtual LossData lossInterval(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi) const;
+
+  /**
+   * Returns the unbounded interval of loss of separation between ownship and intruder (see lossInterval).
+   * @param ownship   ownship state
+   * @param intruder  intruder state
+   * @return unbounded interval of loss of separation
+   */
+  LossData lossIntervalWithTrafficState(const TrafficState& ownship, const TrafficState& intruder) const;
+
+  /**
+   * Returns true if conflict detection is separable into a vertical component, which only depends on the
+   * relative vertical state, and a horizontal component, which only depends on the horizontal one. In this
+   * case, a vertical interval can be reused across horizontal maneuvers. 
+   * - If hasLossInterval() is true, lossInterval(so,vo,si,vi) is equivalent to 
+   *   separableLossInterval(horizontalInterval(s,vo,vi),verticalInterval(sz,voz,viz,B,T)) for any B and T, 
+   *   i.e., horizontal intervals can also be reused across vertical maneuvers.
+   * - Otherwise, conflictDetection(so,vo,si,vi,B,T) is equivalent to 
+   *   horizontalIntervalWithin(verticalInterval(sz,voz,viz,B,T),s,vo,vi,B,T).
+   * Here, s and sz are the horizontal and vertical components of the relative position so-si, vo and voz are
+   * the horizontal and vertical components of the ownship velocity, and vi and viz are the ones of the intruder.
+   */
+  virtual bool hasVerticalInterval() const;
+
+  /**
+   * Returns the time interval where the vertical component of this detector is violated. If hasLossInterval() is true,
+   * the interval is unbounded and B and T are ignored. Otherwise, the interval is within [B,T]. This method is only 
+   * meaningful when hasVerticalInterval() is true. Otherwise, it returns an empty interval.
+   * @param sz  relative vertical position
+   * @param voz ownship vertical speed
+   * @param viz intruder vertical speed
+   * @param B   beginning of detection time (>=0)
+   * @param T   end of detection time
+   */
+  virtual Interval verticalInterval(double sz, double voz, double viz, double B, double T) const;
+
+  /**
+   * Returns the unbounded time interval where the horizontal component of this detector is violated. 
+   * This method is only meaningful when hasVerticalInterval() and hasLossInterval() are true. Otherwise, 
+   * it returns an empty interval.
+   * @param s   relative horizontal position
+   * @param vo  ownship horizontal velocity
+   * @param vi  intruder horizontal velocity
+   */
+  virtual Interval horizontalInterval(const Vect2& s, const Vect2& vo, const Vect2& vi) const;
+
+  /**
+   * Returns the interval of loss of separation given the vertical interval ii computed by verticalInterval. 
+   * This method is only meaningful when hasVerticalInterval() is true and hasLossInterval() is false. Otherwise, 
+   * it returns an empty interval.
+   * @param ii  vertical interval 
+   * @param s   relative horizontal position
+   * @param vo  ownship horizontal velocity
+   * @param vi  intruder horizontal velocity
+   * @param B   beginning of detection time used to compute ii
+   * @param T   end of detection time used to compute ii
+   */
+  virtual LossData horizontalIntervalWithin(const Interval& ii, const Vect2& s, const Vect2& vo, const Vect2& vi, double B, double T) const;
+
+  /**
+   * Returns the unbounded interval of loss of separation that is the intersection of a horizontal and
+   * a vertical interval. 
+   */
+  static LossData separableLossInterval(const Interval& horizontal, const Interval& vertical);
+
   /** This returns a pointer to a new instance of this type of Detector3D.  You are responsible for destroying this instance when it is no longer needed. */
   virtual Detection3D* copy() const = 0;
   virtual Detection3D* make() const = 0;
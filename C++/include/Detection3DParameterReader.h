@@ -9,6 +9,7 @@
 
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include "Detection3D.h"
 #include "ParameterData.h"
 #include "Triple.h"
@@ -20,8 +21,19 @@ namespace larcfm {
  */
 class Detection3DParameterReader {
 private:
-  static std::map<std::string, Detection3D*> registeredDetection3DClasses;
+  /* 
+   * Registered prototypes by class name and their default parameters. New instances are clones
+   * of the prototypes, which are only re-parameterized when given parameters differ from the defaults.
+   */
+  static std::unordered_map<std::string, Detection3D*> registeredDetection3DClasses;
+  static std::unordered_map<std::string, ParameterData> registeredDetection3DDefaults;
   static bool registered;
+
+  /**
+   * Return true if every parameter in params has the same value and units in defaults
+   */
+  static bool sameParameters(const ParameterData& defaults, const ParameterData& params);
+
 public:
 
   /**
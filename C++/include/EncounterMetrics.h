@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef ENCOUNTERMETRICS_H_
+#define ENCOUNTERMETRICS_H_
+
+#include "Vect3.h"
+#include "ConflictData.h"
+#include <vector>
+#include <string>
+
+namespace larcfm {
+
+/**
+ * DAA performance metrics of an encounter between the ownship and a traffic aircraft,
+ * computed in one pass from their relative states. All values are in internal units.
+ * Metrics have the same meaning as the corresponding methods in Daidalus, e.g., hmd is
+ * Daidalus::predictedHorizontalMissDistance.
+ */
+class EncounterMetrics {
+public:
+  // Relative position and velocity of the ownship with respect to traffic aircraft
+  Vect3 s;
+  Vect3 v;
+  // Alerter index used for traffic aircraft
+  int alerter_index;
+  // Violation of alert thresholds, where the i-th element corresponds to alert level i+1
+  std::vector<ConflictData> violations;
+  double horizontal_separation;
+  double vertical_separation;
+  double horizontal_closure_rate;
+  double vertical_closure_rate;
+  double hmd;  // Predicted horizontal miss distance (up to lookahead time)
+  double vmd;  // Predicted vertical miss distance (up to lookahead time)
+  double tcpa; // Time to horizontal closest point of approach (0 if diverging)
+  double dcpa; // Distance at horizontal closest point of approach
+  double tcoa; // Time to co-altitude (negative infinity if vertical closure is 0)
+
+  /**
+   * Creates invalid metrics, i.e., all values are NaN
+   */
+  EncounterMetrics();
+
+  /**
+   * Computes metrics, except violations, from ownship and traffic states
+   * in the Euclidean frame, for a given lookahead time T.
+   */
+  EncounterMetrics(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi, int alerter_idx, double T);
+
+  /**
+   * Computes metrics, except violations, from relative position s and relative velocity v
+   * in the Euclidean frame, for a given lookahead time T.
+   */
+  EncounterMetrics(const Vect3& rel_s, const Vect3& rel_v, int alerter_idx, double T);
+
+  static const EncounterMetrics& INVALID();
+
+  bool isValid() const;
+
+  /**
+   * @return time to violation of alert thresholds of given alert level.
+   * NaN if alert level is not available.
+   */
+  double timeToVolume(int alert_level) const;
+
+  /**
+   * @return modified tau time, in seconds, for distance DMOD (given in internal units).
+   * If aircraft are diverging or DMOD is greater than current range, returns -1.
+   * (see Daidalus::modifiedTau)
+   */
+  double modifiedTau(double DMOD) const;
+
+  std::string toString() const;
+
+private:
+  void compute(double T);
+
+};
+
+}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef ENCOUNTERMETRICSTABLE_H_
+#define ENCOUNTERMETRICSTABLE_H_
+
+#include "EncounterMetrics.h"
+#include <vector>
+#include <string>
+
+namespace larcfm {
+
+/**
+ * Encounter metrics of all traffic aircraft, stored column-wise, i.e., the i-th element of
+ * every column corresponds to the traffic aircraft at index i+1. All values are in internal units.
+ */
+class EncounterMetricsTable {
+public:
+  std::vector<std::string> id;
+  std::vector<int> alerter_index;
+  // time_to_volume[l][i] is the time to violation of alert thresholds of alert level l+1.
+  // It is NaN when the alerter of the aircraft doesn't have such alert level.
+  std::vector<std::vector<double> > time_to_volume;
+  std::vector<double> horizontal_separation;
+  std::vector<double> vertical_separation;
+  std::vector<double> horizontal_closure_rate;
+  std::vector<double> vertical_closure_rate;
+  std::vector<double> hmd;
+  std::vector<double> vmd;
+  std::vector<double> tcpa;
+  std::vector<double> dcpa;
+  std::vector<double> tcoa;
+
+  /**
+   * Remove all rows, keeping allocated memory
+   */
+  void clear();
+
+  /**
+   * Add a row with metrics m of aircraft with given id
+   */
+  void add(const std::string& ac_id, const EncounterMetrics& m);
+
+  /**
+   * @return number of rows
+   */
+  int size() const;
+
+};
+
+}
+
+#endif
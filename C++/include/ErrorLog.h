@@ -15,20 +15,44 @@
 
 #include "ErrorReporter.h"
 #include <string>
+#include <deque>
 
 namespace larcfm {
 
 class ErrorLog : public ErrorReporter {
 private:
+	/**
+	 * Kind of message stored in the log. Value checks are kept in structured form
+	 * and their text is only produced when the message is requested.
+	 */
+	enum Code { TEXT, NON_POSITIVE, NEGATIVE, POSITIVE, NOT_LESS_THAN, NOT_BETWEEN };
+
+	struct Entry {
+		bool error;
+		Code code;
+		const char* method;
+		double val;
+		double lb;
+		double ub;
+		std::string text;
+	};
+
 	std::string name;
-	std::string message;
+	std::deque<Entry> entries;
+	bool truncated;
 	bool has_error;
 	bool fail_fast;
 	bool console_out;
 	int local_purge_flag;
 	static int global_purge_flag;
 	static int limit;
-	int size;
+
+	void checkPurge(bool warning);
+	void add(const Entry& entry);
+	void formatEntry(std::string& out, const Entry& entry) const;
+	static void formatCheck(std::string& out, Code code, const char* method, double val, double lb, double ub);
+	bool failCheck(const std::string& method, Code code, double val, double lb, double ub);
+	bool failCheck(const char* method, Code code, double val, double lb, double ub);
 
 public:
 	/**
@@ -85,6 +109,13 @@ public:
 	 */
 	static void setSizeLimit(int sz);
 
+  /*
+   * The value checks below are overloaded for method names given as string literals.
+   * These overloads do not perform any string operation when the check succeeds. When
+   * it fails, the method name is stored as a pointer, so it must have static storage
+   * duration, and the message is formatted when it is requested.
+   */
+
   /** 
    * Checks if a value is positive and, in that case, returns true. Otherwise, 
    * adds an error message and returns false.
@@ -94,6 +125,7 @@ public:
    * @return true, if value is positive
    */
 	bool isPositive(const std::string& method, double val);
+	bool isPositive(const char* method, double val);
 
   /** 
    * Checks if a value is non negative and, in that case, returns true. Otherwise, 
@@ -104,6 +136,7 @@ public:
    * @return true, if value is non-negative
    */
 	bool isNonNegative(const std::string& method, double val);
+	bool isNonNegative(const char* method, double val);
 
   /** 
    * Checks if a value is non positive and, in that case, returns true. Otherwise, 
@@ -114,6 +147,7 @@ public:
    * @return true, if value is non-positive
    */
 	bool isNonPositive(const std::string& method, double val);
+	bool isNonPositive(const char* method, double val);
 
   /** 
    * Checks if a value is less than value in internal units. Otherwise,
@@ -125,6 +159,7 @@ public:
    * @return true, if value #1 is less than value #2
    */
 	bool isLessThan(const std::string& method, double val, double thr);
+	bool isLessThan(const char* method, double val, double thr);
 
   /** 
    * Checks if a value is between lb and ub. Otherwise, adds an error message 
@@ -137,6 +172,7 @@ public:
    * @return true, if value is between upper and lower bound
    */
 	bool isBetween(const std::string& method, double val, double lb, double ub);
+	bool isBetween(const char* method, double val, double lb, double ub);
 
 	bool hasError() const;
 	bool hasMessage() const;
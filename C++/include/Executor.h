@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef EXECUTOR_H_
+#define EXECUTOR_H_
+
+#include "TaskGroup.h"
+#include <functional>
+
+namespace larcfm {
+
+/**
+ * Interface used by DAIDALUS components to run work in parallel. Components don't create
+ * threads on their own, so that applications can provide an executor backed by their own
+ * scheduler. Executors are shared by reference and must outlive the objects that use them.
+ */
+class Executor {
+
+private:
+  static void run_range(const std::function<void(int)>& body, int first, int last, TaskGroup& group);
+
+public:
+  Executor() {}
+  virtual ~Executor() {}
+
+  /**
+   * Submit task as part of group. The task may run in any thread, including the current one before
+   * this method returns. It is not run if the group is cancelled before it starts.
+   */
+  virtual void submit(TaskGroup& group, const std::function<void()>& task) = 0;
+
+  /**
+   * Block until all tasks of group have finished or have been skipped because of cancellation.
+   * The current thread may run pending tasks while waiting.
+   */
+  virtual void wait(TaskGroup& group) = 0;
+
+  /**
+   * @return number of tasks that may run at the same time
+   */
+  virtual int concurrency() const = 0;
+
+  /**
+   * Run body(i), for first <= i < last, and wait until all of them have finished. Iterations are run in
+   * chunks of consecutive indices and the remaining iterations are skipped when group is cancelled.
+   */
+  virtual void parallel_for(int first, int last, const std::function<void(int)>& body, TaskGroup& group);
+
+  /**
+   * Same as parallel_for with a group that is not cancelled
+   */
+  void parallel_for(int first, int last, const std::function<void(int)>& body);
+
+  /**
+   * @return executor used by components that have not been given one. It is a process-wide
+   * WorkStealingExecutor, created the first time it is needed, with one thread per hardware thread, 
+   * or a SerialExecutor when the library is compiled with DAIDALUS_SERIAL_EXECUTOR.
+   */
+  static Executor& defaultExecutor();
+
+};
+
+}
+
+#endif
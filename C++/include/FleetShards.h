@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef FLEETSHARDS_H_
+#define FLEETSHARDS_H_
+
+#include "Daidalus.h"
+#include "Position.h"
+#include <vector>
+#include <string>
+
+namespace larcfm {
+
+/**
+ * Geographic partition of a fleet of ownships into shards that can be computed independently,
+ * e.g., by different processes. Shards are strips of longitude (or of x, for Euclidean positions),
+ * whose boundaries are chosen so that shards own a similar number of ownships. Traffic aircraft
+ * that are relevant to the ownships of a shard are either in the shard or within a given reach,
+ * i.e., the halo, of its boundaries. The reach should be at least the maximum alerting reach of
+ * the configuration (see alertingReach). Strips are assumed to be narrower than 180 degrees
+ * of longitude, which is the case when there are more than two shards or positions are not spread
+ * around the globe. All positions of a partition are expected to be either lat/lon or Euclidean.
+ * Distances are in internal units.
+ */
+class FleetShards {
+public:
+
+  /**
+   * Creates a partition of the whole space in one shard, with given reach
+   */
+  explicit FleetShards(double reach);
+
+  int numberOfShards() const;
+
+  double getReach() const;
+
+  void setReach(double reach);
+
+  /**
+   * Set boundaries of n shards so that each shard owns a similar number of the given positions
+   */
+  void balance(int n, const std::vector<Position>& positions);
+
+  /**
+   * @return ratio between the number of positions owned by the largest shard and the average
+   * number of positions per shard. It is 1 when shards are perfectly balanced.
+   */
+  double imbalance(const std::vector<Position>& positions) const;
+
+  /**
+   * @return index of the shard, between 0 and numberOfShards()-1, that owns position p
+   */
+  int shardOf(const Position& p) const;
+
+  /**
+   * @return true if p is in shard, or within reach of one of its boundaries
+   */
+  bool inHalo(int shard, const Position& p) const;
+
+  /**
+   * @return maximum horizontal distance at which a traffic aircraft can trigger an alert, or affect bands,
+   * of an ownship within lookahead time, when the horizontal closure speed is at most closure_speed.
+   * This distance is lookahead time times closure speed plus the largest horizontal distance at which a detector
+   * of the configuration reports a violation for aircraft approaching head-on at that closure speed.
+   * If closure_speed is not positive, twice the maximum horizontal speed of the configuration is used.
+   */
+  static double alertingReach(const Daidalus& daa, double closure_speed);
+
+  std::string toString() const;
+
+private:
+  double reach_;
+  bool latlon_;
+  // Boundaries between consecutive shards, i.e., shard i is [bounds_[i-1],bounds_[i])
+  std::vector<double> bounds_;
+
+  static double coordinate(const Position& p);
+
+  // Horizontal distance from p to the boundary at coordinate b
+  double distance_to_boundary(const Position& p, double b) const;
+
+};
+
+}
+
+#endif
@@ -127,6 +127,32 @@ namespace larcfm {
 	 */
   static double distance(const LatLonAlt& p1, const LatLonAlt& p2);
 
+	/**
+	 * Estimate the great circle distance in radians between the two points. This
+	 * is a computationally fast estimate based on the equirectangular approximation
+	 * at the mean latitude of the two points, and only should be used for relatively
+	 * short distances. For points within 10 NM of each other at latitudes up to 60
+	 * degrees, the relative error with respect to angular_distance is below 0.001%.
+	 * The error is larger near the poles and grows with the distance (see
+	 * examples/GreatCircleAccuracy.cpp for an error report).
+	 * 
+	 * @param p1 one point
+	 * @param p2 another point
+	 * @return estimated angular distance
+	 */
+  static double angular_distance_est(const LatLonAlt& p1, const LatLonAlt& p2);
+
+	/**
+	 * Estimate the great circle distance between the two given points. This is a
+	 * computationally fast estimate of distance(p1,p2) that only should be used for
+	 * relatively short distances (see angular_distance_est). This ignores the altitudes.
+	 * 
+	 * @param p1 one point
+	 * @param p2 another point
+	 * @return estimated distance in meters
+	 */
+  static double distance_est(const LatLonAlt& p1, const LatLonAlt& p2);
+
   
 
 	/**
@@ -203,6 +229,20 @@ namespace larcfm {
 	 */
   static double initial_course(const LatLonAlt& p1, const LatLonAlt& p2);
 
+	/**
+	 * Estimate the initial true course at point #1 on the great circle route
+	 * from point #1 to point #2. This is a computationally fast estimate of
+	 * initial_course(p1,p2) based on the rhumb line course between the two points, corrected
+	 * by the convergence of meridians. It only should be used for relatively short distances.
+	 * For points within 10 NM of each other at latitudes up to 60 degrees, the error is below
+	 * 0.001 degrees.
+	 * 
+	 * @param p1 a point
+	 * @param p2 another point
+	 * @return estimated initial course
+	 */
+  static double initial_course_est(const LatLonAlt& p1, const LatLonAlt& p2);
+
 	/**
 	 * <p>Course of the great circle coming in from point #1 to point #2.  This
 	 * value is NOT a compass angle (in the 0 to 2 Pi range), but is in radians 
@@ -571,6 +611,34 @@ public:
 	 */
   static LatLonAlt linear_initial(const LatLonAlt& s, double track, double dist);
 
+	/**
+	 * Estimate the point reached from the given lat/lon when traveling at the given
+	 * velocity for the given amount of time. This is a computationally fast estimate of
+	 * KinematicsLatLon::linear(s,v,t) based on a local flat-earth approximation with a
+	 * second order correction for the curvature of the great circle, and only should be
+	 * used for relatively short distances. For distances up to 10 NM at latitudes up to
+	 * 60 degrees, the error is below 1 m.
+	 * 
+	 * @param s a position
+	 * @param v velocity
+	 * @param t time
+	 * @return estimated end point of a linear extrapolation
+	 */
+  static LatLonAlt linear_initial_est(const LatLonAlt& s, const Velocity& v, double t);
+
+	/**
+	 * Estimate the point reached from the given lat/lon when moving the given distances
+	 * north and east. This is a computationally fast estimate based on a flat-earth
+	 * approximation at the mean latitude of the displacement, and only should be used for
+	 * relatively short distances. The altitude is unchanged.
+	 * 
+	 * @param s a position
+	 * @param dn distance north in meters (negative is south)
+	 * @param de distance east in meters (negative is west)
+	 * @return estimated end point
+	 */
+  static LatLonAlt linear_initial_est(const LatLonAlt& s, double dn, double de);
+
 	/**
 	 * <p>This function forms a great circle from p1 to p2, then computes 
 	 * the shortest distance of another point (offCircle) to the great circle.  This is the 
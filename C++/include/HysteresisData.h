@@ -45,6 +45,27 @@ public:
 
   std::string toString() const;
 
+  /*
+   * Write internal state of this object into buf
+   */
+  void writeState(StateBuffer& buf) const;
+
+  /*
+   * Read internal state of this object from buf. Return false if buf has an error.
+   */
+  bool readState(StateBuffer& buf);
+
+  /*
+   * @return estimated number of bytes allocated by this object, not including the object itself
+   */
+  int memoryUsage() const;
+
+  /*
+   * Return true if this object would be reset when its logic is applied at current_time, i.e.,
+   * it has never been applied or its hysteresis time has passed.
+   */
+  bool isExpired(double current_time) const;
+
   /*
    * In addition of m_of_n, this function applies persistence logic
    */
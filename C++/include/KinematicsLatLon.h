@@ -53,6 +53,17 @@ public:
 	 */
 	static std::pair<LatLonAlt,Velocity> linear(std::pair<LatLonAlt,Velocity> sv0, double t);
 
+	/**
+	 * Estimate the linear projection of the given position and velocity. This is a computationally 
+	 * fast estimate of linear(so,vo,t) that only should be used for relatively short distances
+	 * (see GreatCircle::linear_initial_est).
+	 * @param so  initial position
+	 * @param vo  initial velocity
+	 * @param t   time
+	 * @return estimated linear projection of (so,vo) to time t
+	 */
+	static std::pair<LatLonAlt,Velocity> linearEst(const LatLonAlt& so, const Velocity& vo, double t);
+
 	/**
 	 * Determine the earth-surface radius of a turn given the ground speed and omega (angular velocity).
 	 * @param speed
@@ -82,6 +93,19 @@ public:
 	 */
 	static std::pair<LatLonAlt,Velocity> turnOmega(std::pair<LatLonAlt,Velocity> sv0, double t, double omega) ;
 
+	/**
+	 * Estimate the position/velocity after turning t time units according to track rate omega.
+	 * This is a computationally fast estimate of turnOmega(so,vo,t,omega), where the turn is computed 
+	 * in a local flat-earth frame at so. It only should be used for relatively short distances. For turns
+	 * covering up to 10 NM at latitudes up to 60 degrees, the position error is below 1 m.
+	 * @param so          starting position
+	 * @param vo          initial velocity
+	 * @param t           time into turn
+	 * @param omega       rate of change of track, sign indicates direction
+	 * @return estimated Position/Velocity after t time
+	 */
+	static std::pair<LatLonAlt,Velocity> turnOmegaEst(const LatLonAlt& so, const Velocity& vo, double t, double omega);
+
 //	static std::pair<LatLonAlt,Velocity> turnRadius(const LatLonAlt& so, const Velocity& vo, double t, double signedRadius);
 
 	
@@ -59,6 +59,14 @@ public:
 	 */
 	bool conflict(double thr) const;
 
+	/**
+	 * Assuming that this object is the unbounded loss interval of a linear relative state 
+	 * (see Detection3D::lossInterval), returns true if there is a conflict between times B and T.
+	 * This is the same answer given by Detection3D::conflict(so,vo,si,vi,B,T) for detectors that
+	 * have an interval form.
+	 */
+	bool conflictBetween(double B, double T) const;
+
 	/**
 	 * Returns time to first loss in seconds.
 	 * Note: this returns positive infinity if there is not a conflict!
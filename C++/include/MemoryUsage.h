@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef MEMORYUSAGE_H_
+#define MEMORYUSAGE_H_
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <string>
+
+namespace larcfm {
+
+class Detection3D;
+
+/**
+ * Estimated memory footprint, in bytes, of a Daidalus object by component. Estimates add the size of
+ * the object itself to the memory allocated by its containers, assuming the node and block layouts of
+ * common standard library implementations, and are meant to compare components and configurations
+ * rather than to match the figures reported by the allocator.
+ */
+class MemoryUsage {
+public:
+  // Size of the Daidalus object itself, i.e., everything that is not allocated by containers
+  int object;
+  // Alerters, detectors, units, and compiled alerting plan
+  int parameters;
+  // Ownship and traffic states, including the table of relative states
+  int traffic;
+  // Alerting and DTA hysteresis per aircraft
+  int alerting_hysteresis;
+  // M of N and persistence information of bands in all dimensions
+  int bands_hysteresis;
+  // Per cycle caches of the core: conflict aircraft, conflict detections, DTA status, and encounter metrics
+  int core_caches;
+  // Per cycle caches of bands: ranges, contributing aircraft, and sample caches
+  int bands_caches;
+
+  MemoryUsage();
+
+  int total() const;
+
+  std::string toString() const;
+
+  /* Estimation helpers */
+
+  static int string_bytes(const std::string& s);
+
+  template<typename T>
+  static int vector_bytes(const std::vector<T>& v) {
+    return static_cast<int>(v.capacity()*sizeof(T));
+  }
+
+  static int vector_bytes(const std::vector<bool>& v);
+
+  template<typename T>
+  static int deque_bytes(const std::deque<T>& d) {
+    return DEQUE_MAP_BYTES+static_cast<int>((d.size()*sizeof(T))/DEQUE_BLOCK_BYTES+1)*DEQUE_BLOCK_BYTES;
+  }
+
+  // Nodes of a map, not including memory allocated by keys and values
+  template<typename K, typename V>
+  static int map_bytes(const std::map<K,V>& m) {
+    return static_cast<int>(m.size()*(MAP_NODE_BYTES+sizeof(std::pair<const K,V>)));
+  }
+
+  static int units_bytes(const std::map<std::string,std::string>& units);
+
+  /**
+   * @return estimated memory allocated by detector, including the detector itself
+   */
+  static int detector_bytes(const Detection3D& det);
+
+private:
+  // Red-black tree node header: color and three pointers
+  static const int MAP_NODE_BYTES = 4*sizeof(void*);
+  // A deque allocates a map of block pointers and blocks of 512 bytes
+  static const int DEQUE_MAP_BYTES = 8*sizeof(void*);
+  static const int DEQUE_BLOCK_BYTES = 512;
+  // Short strings are stored in the string object itself
+  static const int SHORT_STRING_CAPACITY = 15;
+};
+
+}
+
+#endif
@@ -12,6 +12,7 @@
 #ifndef MOFN_H_
 #define MOFN_H_
 
+#include "StateBuffer.h"
 #include <deque>
 #include <string>
 
@@ -61,6 +62,21 @@ public:
 
   std::string toString() const;
 
+  /*
+   * Write internal state of this object into buf
+   */
+  void writeState(StateBuffer& buf) const;
+
+  /*
+   * Read internal state of this object from buf. Return false if buf has an error.
+   */
+  bool readState(StateBuffer& buf);
+
+  /*
+   * @return estimated number of bytes allocated by this object, not including the object itself
+   */
+  int memoryUsage() const;
+
 private:
   int m_;
   int n_;
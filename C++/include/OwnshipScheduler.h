@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef OWNSHIPSCHEDULER_H_
+#define OWNSHIPSCHEDULER_H_
+
+#include "Daidalus.h"
+#include <map>
+#include <vector>
+#include <string>
+
+namespace larcfm {
+
+/**
+ * Scheduler of computations for applications that maintain one Daidalus object per ownship, e.g.,
+ * surveillance servers. Ownships are classified by priority after each computation:
+ * <ul>
+ * <li> URGENT: some traffic aircraft is alerting, or is predicted to violate corrective thresholds within
+ * lookahead time.
+ * <li> ACTIVE: the most urgent aircraft reaches closest point of approach within lookahead time, or some
+ * traffic aircraft could get close enough to be in conflict before the next computation of an active
+ * ownship, assuming a conservative closure speed.
+ * <li> QUIET: otherwise. The period of quiet ownships is reduced when traffic is close enough to be
+ * in conflict before the end of that period.
+ * </ul>
+ * An ownship is due when its deadline, i.e., time of last computation plus the period of its
+ * priority, has been reached. A deadline miss is counted when a due ownship is left out of a
+ * schedule after its deadline has passed. Each deadline is missed at most once.
+ * Times are in seconds and distances and speeds in internal units. Time is given by the current time of
+ * Daidalus objects and by the time passed to schedule, which are expected to use the same clock.
+ */
+class OwnshipScheduler {
+public:
+  static const int URGENT = 0;
+  static const int ACTIVE = 1;
+  static const int QUIET = 2;
+  static const int PRIORITIES = 3;
+
+  /**
+   * Creates a scheduler where urgent ownships are computed every cycle, active ownships every 2 [s],
+   * and quiet ownships at most every 10 [s]. Closure speed is twice the maximum horizontal speed of
+   * each ownship's configuration.
+   */
+  OwnshipScheduler();
+
+  /**
+   * Set period, in seconds, of given priority. A period of 0 means every cycle.
+   */
+  void setPeriod(int priority, double period);
+
+  double getPeriod(int priority) const;
+
+  /**
+   * Set conservative horizontal closure speed used to bound the time traffic aircraft need to get in conflict.
+   * A non-positive or NaN value means twice the maximum horizontal speed of each ownship's configuration.
+   */
+  void setClosureSpeed(double speed);
+
+  double getClosureSpeed() const;
+
+  /**
+   * Notify that new ownship or traffic states have been set in daa, whose ownship is identified by id.
+   * Unknown ownships are urgent and due immediately. Quiet ownships are promoted to active, and due immediately,
+   * when traffic could get in conflict before their next computation. This check is cheap, since it only uses
+   * aircraft states.
+   * @return priority of the ownship
+   */
+  int inputsUpdated(const std::string& id, const Daidalus& daa);
+
+  /**
+   * Notify that daa, whose ownship is identified by id, has been computed at its current time. Its priority
+   * and next deadline are updated from alert levels, times to corrective volume, and time to closest point of
+   * approach of the most urgent aircraft.
+   * @return priority of the ownship
+   */
+  int completed(const std::string& id, Daidalus& daa);
+
+  /**
+   * Remove ownship identified by id
+   */
+  void remove(const std::string& id);
+
+  /**
+   * Put in ids the identifiers of the ownships that are due at given time, ordered by priority
+   * and then by deadline. At most budget identifiers are returned, unless budget is negative.
+   */
+  void schedule(double time, int budget, std::vector<std::string>& ids);
+
+  /**
+   * @return priority of ownship identified by id, or -1 if it is unknown
+   */
+  int priorityOf(const std::string& id) const;
+
+  /**
+   * @return deadline of ownship identified by id, or NaN if it is unknown
+   */
+  double deadlineOf(const std::string& id) const;
+
+  /**
+   * @return number of ownships of given priority
+   */
+  int numberOfOwnships(int priority) const;
+
+  /**
+   * @return number of times ownships of given priority have been scheduled since statistics were last reset
+   */
+  int computations(int priority) const;
+
+  /**
+   * @return number of deadline misses of ownships of given priority since statistics were last reset
+   */
+  int deadlineMisses(int priority) const;
+
+  void resetStatistics();
+
+  std::string toString() const;
+
+private:
+  class Entry {
+  public:
+    int priority;
+    double deadline;
+    bool missed; // True if current deadline has already been counted as missed
+    Entry();
+  };
+
+  double period_[PRIORITIES];
+  double closure_speed_;
+  int computations_[PRIORITIES];
+  int misses_[PRIORITIES];
+  std::map<std::string,Entry> entries_;
+
+  /**
+   * @return time after which some traffic aircraft could be in conflict with the ownship of daa,
+   * assuming a conservative closure speed. Return positive infinity if there is no traffic.
+   */
+  double time_to_proximity(const Daidalus& daa) const;
+
+};
+
+}
+
+#endif
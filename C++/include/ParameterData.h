@@ -28,8 +28,18 @@
 namespace larcfm {
 
 struct stringCaseInsensitive {
-	bool operator() (const std::string& lhs, const std::string& rhs) const
-	{return toLowerCase(lhs)<toLowerCase(rhs);}
+	// Same order as toLowerCase(lhs)<toLowerCase(rhs), without building the lower case strings
+	bool operator() (const std::string& lhs, const std::string& rhs) const {
+		std::string::size_type n = std::min(lhs.size(),rhs.size());
+		for (std::string::size_type i = 0; i < n; ++i) {
+			unsigned char l = static_cast<unsigned char>(static_cast<char>(tolower(lhs[i])));
+			unsigned char r = static_cast<unsigned char>(static_cast<char>(tolower(rhs[i])));
+			if (l != r) {
+				return l < r;
+			}
+		}
+		return lhs.size() < rhs.size();
+	}
 };
 
 /**
@@ -466,6 +476,23 @@ public:
 	 */
 	bool parseParameterList(const std::string& separator, std::string line);
 
+	/**
+	 * Write this ParameterData, in entry order, to a binary stream. Entries are written as they are stored,
+	 * i.e., string values, values in internal units, units, and comments, so that they can be read back
+	 * with readBinary without any parsing.
+	 * @param out binary output stream
+	 * @return true if all entries were written successfully
+	 */
+	bool writeBinary(std::ostream& out) const;
+
+	/**
+	 * Read in a set of parameters as created by writeBinary().
+	 * @param in binary input stream
+	 * @return true if all entries were read successfully. If this returns false, one or more entries were not
+	 * added to the database.
+	 */
+	bool readBinary(std::istream& in);
+
 	/**
 	 * Returns true if the stored value for key is likely a boolean
 	 * @param key parameter name
@@ -587,17 +614,9 @@ private:
 
 	class comp_order {
 	public:
-		const paramtype *params;
-		explicit comp_order(const paramtype *p) {
-			params = p;
-		}
-		bool operator() (const std::string& lhs, const std::string& rhs) const
+		bool operator() (const std::pair<long,std::string>& lhs, const std::pair<long,std::string>& rhs) const
 		{
-			paramtype::const_iterator p1 = params->find(lhs);
-			paramtype::const_iterator p2 = params->find(rhs);
-			long n1 = p1->second.order;
-			long n2 = p2->second.order;
-			return n1<n2;
+			return lhs.first<rhs.first;
 		}
 	} ;
 
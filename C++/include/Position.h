@@ -279,6 +279,14 @@ public:
 	 * */
 	double distanceH(const Position& p) const;
 
+	/** Return an estimate of the horizontal distance between the current Position and the given Position.
+	 * For lat/lon positions, this is a computationally fast estimate that only should be used for relatively
+	 * short distances (see GreatCircle::distance_est). For Euclidean positions, it is the same as distanceH.
+	 * @param p another position
+	 * @return estimated horizontal distance
+	 * */
+	double distanceHEst(const Position& p) const;
+
 	/** Return the vertical distance between the current Position and the given Position.
 	 *
 	 * @param p another position
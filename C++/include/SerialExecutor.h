@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef SERIALEXECUTOR_H_
+#define SERIALEXECUTOR_H_
+
+#include "Executor.h"
+
+namespace larcfm {
+
+/**
+ * Executor that runs every task in the calling thread when it is submitted. It doesn't use
+ * threads, so results and order of evaluation are deterministic.
+ */
+class SerialExecutor : public Executor {
+
+public:
+  SerialExecutor() {}
+
+  virtual void submit(TaskGroup& group, const std::function<void()>& task);
+
+  virtual void wait(TaskGroup& group);
+
+  virtual int concurrency() const;
+
+};
+
+}
+
+#endif
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef SHADOWCHECKER_H_
+#define SHADOWCHECKER_H_
+
+#include "Daidalus.h"
+#include "DaidalusResult.h"
+#include "ParameterData.h"
+#include "SerialExecutor.h"
+#include <vector>
+#include <string>
+
+namespace larcfm {
+
+/**
+ * Output of a Daidalus object that differs from the one computed by the reference path.
+ * Values are in internal units.
+ */
+class ShadowMismatch {
+public:
+  // Name of the output, e.g., "Alert Level AC1" or "Horizontal Direction Bands"
+  std::string output;
+  std::string fast;
+  std::string reference;
+
+  ShadowMismatch(const std::string& output, const std::string& fast, const std::string& reference);
+
+  std::string toString() const;
+};
+
+/**
+ * Report of a time step where the outputs of a Daidalus object differ from those of the reference path.
+ * It contains the inputs that reproduce the time step: configuration, and runtime state as produced by
+ * Daidalus::serializeState, which includes aircraft states and hysteresis information.
+ */
+class ShadowReport {
+public:
+  double time;
+  std::string ownship;
+  ParameterData configuration;
+  std::string state;
+  // Aircraft states in the format of encounter files
+  std::string aircraft_states;
+  std::vector<ShadowMismatch> mismatches;
+
+  ShadowReport();
+
+  /**
+   * Set configuration and runtime state of daa to the ones of this report. Executor, urgency strategy, and
+   * other settings that are not configuration parameters are not modified.
+   * @return true if the state was restored
+   */
+  bool reproduce(Daidalus& daa) const;
+
+  std::string toString() const;
+};
+
+/**
+ * Shadow mode for Daidalus objects. For a sample of time steps, outputs computed by the object,
+ * i.e., the fast path, are compared to outputs computed by a copy that uses the reference path:
+ * a SerialExecutor, one recovery thread, sampled vertical speed bands, and empty caches.
+ * Compared outputs are bands, resolutions, preferred directions, and recovery information
+ * in every dimension, alert levels, and last times to maneuver with respect to every traffic aircraft.
+ * Numerical values agree when they differ by at most the tolerance of their dimension,
+ * or of time for times to recovery and last times to maneuver. Tolerances are in internal units.
+ * Time steps are sampled deterministically, e.g., a rate of 0.01 checks one in every 100 time steps.
+ * Time steps that are not sampled only cost an addition.
+ */
+class ShadowChecker {
+public:
+  static const int DIRECTION = 0;
+  static const int HORIZONTAL_SPEED = 1;
+  static const int VERTICAL_SPEED = 2;
+  static const int ALTITUDE = 3;
+  static const int DIMENSIONS = 4;
+
+  /**
+   * Creates a checker with given sampling rate, tolerances of 1E-6 in internal units, and at most
+   * 16 stored reports.
+   */
+  explicit ShadowChecker(double rate=0.01);
+
+  /**
+   * Set fraction of time steps that are checked, a value between 0 and 1.
+   */
+  void setSamplingRate(double rate);
+
+  double getSamplingRate() const;
+
+  /**
+   * Set tolerance of bands and resolutions in given dimension (internal units).
+   */
+  void setTolerance(int dim, double tol);
+
+  double getTolerance(int dim) const;
+
+  /**
+   * Set tolerance of times to recovery and last times to maneuver, in seconds.
+   */
+  void setTimeTolerance(double tol);
+
+  double getTimeTolerance() const;
+
+  /**
+   * Set maximum number of stored reports. Mismatches are counted after this number is reached, but
+   * their reports are discarded.
+   */
+  void setMaxReports(int max);
+
+  int getMaxReports() const;
+
+  /**
+   * Check the current time step of daa, if it is sampled. This method has to be called after the states
+   * of the time step have been set and before any output of daa is computed, since the reference path starts
+   * from the runtime state of daa, including hysteresis information, before the time step is computed.
+   * @return false if the time step was checked and a mismatch was found
+   */
+  bool check(Daidalus& daa);
+
+  /**
+   * Check the current time step of daa, whether it is sampled or not. Same conditions as in check apply.
+   * @return false if a mismatch was found
+   */
+  bool checkNow(Daidalus& daa);
+
+  /**
+   * @return number of time steps passed to check
+   */
+  int timeSteps() const;
+
+  /**
+   * @return number of time steps that have been checked
+   */
+  int checkedTimeSteps() const;
+
+  /**
+   * @return number of checked time steps with mismatches
+   */
+  int mismatchedTimeSteps() const;
+
+  /**
+   * @return stored reports, in the order they were found
+   */
+  const std::vector<ShadowReport>& getReports() const;
+
+  /**
+   * Clear counters and reports
+   */
+  void reset();
+
+  std::string toString() const;
+
+private:
+  double rate_;
+  // Accumulated sampling rate. A time step is checked when it reaches 1.
+  double credit_;
+  double tolerance_[DIMENSIONS];
+  double time_tolerance_;
+  int max_reports_;
+  int time_steps_;
+  int checked_;
+  int mismatched_;
+  std::vector<ShadowReport> reports_;
+  SerialExecutor serial_;
+
+  static bool agree(double fast, double reference, double tol);
+  static std::string bands_to_string(const DaidalusResult& result, int dim);
+  static bool bands_agree(const DaidalusResult& fast, const DaidalusResult& reference, int dim, double tol);
+  static double resolution(const DaidalusResult& result, int dim, bool dir);
+  static bool preferred(const DaidalusResult& result, int dim);
+  static const RecoveryInformation& recovery(const DaidalusResult& result, int dim);
+  static double last_time_to_maneuver(Daidalus& daa, int dim, int ac_idx);
+  void compare(Daidalus& fast, Daidalus& reference, std::vector<ShadowMismatch>& mismatches) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef STATEBUFFER_H_
+#define STATEBUFFER_H_
+
+#include "Vect3.h"
+#include <string>
+
+namespace larcfm {
+
+/**
+ * Binary buffer used to serialize and restore the runtime state of DAIDALUS objects.
+ * Values are written in the byte order of the host, so serialized states can only be
+ * exchanged between hosts of the same architecture. Reading past the end of the buffer,
+ * or reading an invalid length, sets an error flag and returns a default value.
+ */
+class StateBuffer {
+public:
+
+  /**
+   * Creates an empty buffer for writing
+   */
+  StateBuffer();
+
+  /**
+   * Creates a buffer for reading the given data
+   */
+  explicit StateBuffer(const std::string& data);
+
+  /**
+   * Remove all data, keeping allocated memory, and clear error flag
+   */
+  void clear();
+
+  /**
+   * Exchange contents of this buffer with data. This method can be used to reuse memory
+   * allocated by data between calls.
+   */
+  void swap(std::string& data);
+
+  const std::string& data() const;
+
+  /**
+   * @return true if a read operation failed
+   */
+  bool hasError() const;
+
+  /**
+   * Flag an error, e.g., when a read value is not valid
+   */
+  void setError();
+
+  /**
+   * @return true if all data has been read
+   */
+  bool atEnd() const;
+
+  void writeInt(int val);
+  void writeDouble(double val);
+  void writeBool(bool val);
+  void writeString(const std::string& val);
+  void writeVect3(const Vect3& val);
+
+  int readInt();
+  double readDouble();
+  bool readBool();
+  std::string readString();
+  Vect3 readVect3();
+
+  /**
+   * Read a number of elements, each one using at least min_bytes bytes. An error is flagged
+   * if this number is negative or if there are not enough remaining bytes for these elements.
+   */
+  int readCount(int min_bytes);
+
+private:
+  std::string data_;
+  std::string::size_type pos_;
+  bool error_;
+
+  bool read(void* val, std::string::size_type size);
+
+};
+
+}
+
+#endif
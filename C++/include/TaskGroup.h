@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef TASKGROUP_H_
+#define TASKGROUP_H_
+
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+namespace larcfm {
+
+/**
+ * Set of tasks submitted to an Executor by one call, e.g., Executor::parallel_for. It is used to
+ * wait for the tasks and to cancel them: tasks that haven't started when the group is cancelled
+ * are not run, and parallel_for stops between iterations.
+ */
+class TaskGroup {
+
+private:
+  std::atomic<int> pending_;
+  std::atomic<bool> cancelled_;
+  std::mutex mutex_;
+  std::condition_variable finished_;
+
+  TaskGroup(const TaskGroup&);
+  TaskGroup& operator=(const TaskGroup&);
+
+public:
+  TaskGroup();
+
+  /**
+   * Tasks of this group that haven't started will not be run
+   */
+  void cancel();
+
+  bool isCancelled() const;
+
+  /**
+   * @return number of tasks of this group that haven't finished
+   */
+  int pending() const;
+
+  /* The following methods are used by executors */
+
+  // A task has been submitted
+  void add();
+
+  // A task has finished or has been skipped
+  void done();
+
+  // Block until all tasks of this group have finished
+  void wait_finished();
+
+};
+
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef TRAFFICTABLE_H_
+#define TRAFFICTABLE_H_
+
+#include "TrafficState.h"
+#include "Vect3.h"
+#include <vector>
+
+namespace larcfm {
+
+/**
+ * Kinematic state of all traffic aircraft relative to the ownship, stored column-wise, i.e.,
+ * the i-th element of every column corresponds to the aircraft at handle[i] in the traffic list.
+ * This table is used by per-cycle scans over the traffic, which only need Euclidean states, SUM
+ * errors, and alerter indices. TrafficState objects remain the reference for all other data.
+ * All values are in internal units.
+ * INTERNAL USE ONLY
+ */
+class TrafficTable {
+public:
+  // 0-based index in the traffic list
+  std::vector<int> handle;
+  // Position and velocity of the traffic aircraft in the Euclidean frame of the ownship
+  std::vector<Vect3> si;
+  std::vector<Vect3> vi;
+  // Relative position and velocity, i.e., so-si and vo-vi
+  std::vector<Vect3> s;
+  std::vector<Vect3> v;
+  // Alerter index of the traffic aircraft (not modified by DTA logic)
+  std::vector<int> alerter_index;
+  // SUM error terms
+  std::vector<double> s_EW_std;
+  std::vector<double> s_NS_std;
+  std::vector<double> s_EN_std;
+  std::vector<double> sz_std;
+  std::vector<double> v_EW_std;
+  std::vector<double> v_NS_std;
+  std::vector<double> v_EN_std;
+  std::vector<double> vz_std;
+
+  /**
+   * Remove all rows, keeping allocated memory
+   */
+  void clear();
+
+  /**
+   * Remove all rows and release allocated memory
+   */
+  void release();
+
+  /**
+   * @return estimated number of bytes allocated by the columns of this table
+   */
+  int memoryUsage() const;
+
+  /**
+   * Replace contents of table with the states of traffic relative to ownship
+   */
+  void build(const TrafficState& ownship, const std::vector<TrafficState>& traffic);
+
+  /**
+   * @return number of rows
+   */
+  int size() const;
+
+};
+
+}
+
+#endif
@@ -16,6 +16,7 @@
 
 #include "Detection3D.h"
 #include "TrafficState.h"
+#include "TrafficTable.h"
 
 namespace larcfm {
 
@@ -32,6 +33,16 @@ public:
    */
 
   virtual int mostUrgentAircraft(const TrafficState& ownship, const std::vector<TrafficState>& traffic, double T) const = 0;
+
+  /**
+   * Same as above, where table contains the states of traffic relative to ownship. Strategies that only
+   * depend on Euclidean states may override this method to scan the table instead of the traffic list.
+   */
+  virtual int mostUrgentAircraft(const TrafficState& ownship, const std::vector<TrafficState>& traffic, const TrafficTable& table, double T) const {
+    (void)table; //bypass unused parameter warning (needed for interface)
+    return mostUrgentAircraft(ownship,traffic,T);
+  }
+
   virtual UrgencyStrategy* copy() const = 0;
 };
 
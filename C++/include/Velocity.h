@@ -249,6 +249,15 @@ public:
 	 */
 	static Velocity mkTrkGsVs(const double trk, const double gs, const double vs);
 
+	/**
+	 * New velocity from cached track and ground speed, and from components, in internal units.
+	 * No consistency check is performed between these values. This method is intended to restore
+	 * velocities that were saved using trk(), gs(), x(), y(), and z().
+	 *
+	 * @return the velocity
+	 */
+	static Velocity mkTrkGsVxyz(const double trk, const double gs, const double vx, const double vy, const double vz);
+
 
 	/**
 	 * New velocity from Track, Ground Speed, and Vertical speed in explicit units.
@@ -58,6 +58,12 @@ public:
   virtual ConflictData conflictDetectionWithTrafficState(const TrafficState& ownship, const TrafficState& intruder,
       double B, double T) const;
 
+  /**
+   * Sensor uncertainty mitigation is not separable since position and velocity errors depend on the 
+   * full relative state.
+   */
+  virtual bool hasVerticalInterval() const { return false; }
+
 private:
 
   double  h_pos_z_score_;          // Number of horizontal position standard deviations
@@ -88,6 +88,12 @@ public:
 
   LossData WCV_interval(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi, double B, double T) const;
 
+  virtual bool hasVerticalInterval() const;
+
+  virtual Interval verticalInterval(double sz, double voz, double viz, double B, double T) const;
+
+  virtual LossData horizontalIntervalWithin(const Interval& ii, const Vect2& s, const Vect2& vo, const Vect2& vi, double B, double T) const;
+
   bool containsTable(const WCV_tvar& wcv) const;
 
   virtual std::string toString() const;
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#ifndef WORKSTEALINGEXECUTOR_H_
+#define WORKSTEALINGEXECUTOR_H_
+
+#include "Executor.h"
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <atomic>
+
+namespace larcfm {
+
+/**
+ * Executor with a fixed number of threads. Each thread has its own queue of tasks: tasks submitted
+ * by a thread of the executor go to its queue, where they are taken in LIFO order, and idle threads steal
+ * the oldest tasks of other queues. Tasks submitted by other threads are distributed among the queues.
+ * A thread that waits for a group runs pending tasks until the group has finished, so tasks may submit
+ * and wait for other tasks.
+ */
+class WorkStealingExecutor : public Executor {
+
+private:
+  class Job {
+  public:
+    std::function<void()> task;
+    TaskGroup* group;
+    Job() : group(NULL) {}
+    Job(const std::function<void()>& t, TaskGroup* g) : task(t), group(g) {}
+  };
+
+  class Queue {
+  public:
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  std::vector<std::unique_ptr<Queue> > queues_;
+  std::vector<std::thread> threads_;
+  // Number of jobs in all queues
+  std::atomic<int> queued_;
+  std::atomic<unsigned int> next_queue_;
+  bool stop_;
+  std::mutex idle_mutex_;
+  std::condition_variable idle_;
+
+  // Executor and queue index of the current thread, if it belongs to an executor
+  static thread_local WorkStealingExecutor* current_executor_;
+  static thread_local int current_queue_;
+
+  WorkStealingExecutor(const WorkStealingExecutor&);
+  WorkStealingExecutor& operator=(const WorkStealingExecutor&);
+
+  void worker(int idx);
+  bool pop(int idx, Job& job);
+  bool steal(int idx, Job& job);
+  bool take(Job& job);
+  static void run(Job& job);
+
+public:
+  /**
+   * Creates an executor with given number of threads (at least 1)
+   */
+  explicit WorkStealingExecutor(int threads);
+
+  /**
+   * Waits for the threads to finish queued tasks
+   */
+  virtual ~WorkStealingExecutor();
+
+  virtual void submit(TaskGroup& group, const std::function<void()>& task);
+
+  virtual void wait(TaskGroup& group);
+
+  virtual int concurrency() const;
+
+};
+
+}
+
+#endif
@@ -5,6 +5,7 @@
  * Rights Reserved.
  */
 #include "AlertThresholds.h"
+#include "MemoryUsage.h"
 #include "Vect3.h"
 #include "Util.h"
 #include "Velocity.h"
@@ -414,4 +415,12 @@ std::string AlertThresholds::getUnits(const std::string& key) const {
   return got->second;
 }
 
+int AlertThresholds::memoryUsage() const {
+  int bytes = MemoryUsage::units_bytes(units_);
+  if (detector_) {
+    bytes += MemoryUsage::detector_bytes(*detector_);
+  }
+  return bytes;
+}
+
 }
@@ -6,6 +6,7 @@
  */
 
 #include "Alerter.h"
+#include "MemoryUsage.h"
 #include "ParameterData.h"
 #include "Detection3DParameterReader.h"
 #include "Detection3DParameterWriter.h"
@@ -564,6 +565,13 @@ std::string Alerter::listToPVS(const std::vector<Alerter>& alerters) {
   return s+" :)";
 }
 
-
+int Alerter::memoryUsage() const {
+  int bytes = MemoryUsage::string_bytes(id_)+MemoryUsage::vector_bytes(levels_);
+  std::vector<AlertThresholds>::const_iterator ptr;
+  for (ptr = levels_.begin(); ptr != levels_.end(); ++ptr) {
+    bytes += ptr->memoryUsage();
+  }
+  return bytes;
+}
 
 }
@@ -10,6 +10,7 @@
  */
 
 #include "BandsHysteresis.h"
+#include "MemoryUsage.h"
 #include "DaidalusParameters.h"
 
 namespace larcfm {
@@ -490,5 +491,79 @@ std::string BandsHysteresis::toString() const {
   return s;
 }
 
+void BandsHysteresis::writeState(StateBuffer& buf) const {
+  buf.writeDouble(mod_);
+  buf.writeDouble(hysteresis_time_);
+  buf.writeDouble(persistence_time_);
+  buf.writeBool(bands_persistence_);
+  buf.writeDouble(last_time_);
+  buf.writeInt(m_);
+  buf.writeInt(n_);
+  buf.writeInt(bands_mofn_.size());
+  for (int i=0; i < static_cast<int>(bands_mofn_.size()); ++i) {
+    bands_mofn_[i].writeState(buf);
+  }
+  buf.writeBool(preferred_dir_);
+  buf.writeDouble(time_of_dir_);
+  buf.writeInt(BandsRegion::orderOfRegion(conflict_region_));
+  buf.writeDouble(conflict_region_low_);
+  buf.writeDouble(conflict_region_up_);
+  buf.writeDouble(time_of_conflict_region_);
+  buf.writeDouble(resolution_up_);
+  buf.writeDouble(resolution_low_);
+  buf.writeDouble(raw_up_);
+  buf.writeDouble(raw_low_);
+  buf.writeInt(nfactor_up_);
+  buf.writeInt(nfactor_low_);
+}
+
+bool BandsHysteresis::readState(StateBuffer& buf) {
+  setMod(buf.readDouble());
+  hysteresis_time_ = buf.readDouble();
+  persistence_time_ = buf.readDouble();
+  bands_persistence_ = buf.readBool();
+  last_time_ = buf.readDouble();
+  m_ = buf.readInt();
+  n_ = buf.readInt();
+  int size = buf.readCount(sizeof(double));
+  bands_mofn_.clear();
+  for (int i=0; i < size && !buf.hasError(); ++i) {
+    BandsMofN bands(0.0,MofN());
+    bands.readState(buf);
+    bands_mofn_.push_back(bands);
+  }
+  preferred_dir_ = buf.readBool();
+  time_of_dir_ = buf.readDouble();
+  conflict_region_ = BandsRegion::regionFromOrder(buf.readInt());
+  conflict_region_low_ = buf.readDouble();
+  conflict_region_up_ = buf.readDouble();
+  time_of_conflict_region_ = buf.readDouble();
+  resolution_up_ = buf.readDouble();
+  resolution_low_ = buf.readDouble();
+  raw_up_ = buf.readDouble();
+  raw_low_ = buf.readDouble();
+  nfactor_up_ = buf.readInt();
+  nfactor_low_ = buf.readInt();
+  return !buf.hasError();
+}
+
+int BandsHysteresis::memoryUsage() const {
+  int bytes = MemoryUsage::vector_bytes(bands_mofn_);
+  std::vector<BandsMofN>::const_iterator ptr;
+  for (ptr = bands_mofn_.begin(); ptr != bands_mofn_.end(); ++ptr) {
+    bytes += ptr->colors_left.memoryUsage()+ptr->colors_right.memoryUsage();
+  }
+  return bytes;
+}
+
+bool BandsHysteresis::trimIfExpired(double current_time) {
+  if (!ISNAN(last_time_) && current_time > last_time_ && current_time-last_time_ <= hysteresis_time_) {
+    return false;
+  }
+  reset();
+  std::vector<BandsMofN>().swap(bands_mofn_);
+  return true;
+}
+
 } /* namespace larcfm */
 
@@ -58,6 +58,19 @@ std::string BandsMofN::listToString(const std::vector<BandsMofN>& l) {
   return s;
 }
 
+void BandsMofN::writeState(StateBuffer& buf) const {
+  buf.writeDouble(val);
+  colors_left.writeState(buf);
+  colors_right.writeState(buf);
+}
+
+bool BandsMofN::readState(StateBuffer& buf) {
+  val = buf.readDouble();
+  colors_left.readState(buf);
+  colors_right.readState(buf);
+  return !buf.hasError();
+}
+
 } /* namespace larcfm */
 
 
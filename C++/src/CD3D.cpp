@@ -72,35 +72,30 @@ LossData CD3D::detection(const Vect3& s, const Vect3& vo, const Vect3& vi,
 
 LossData CD3D::detectionActual(const Vect3& s, const Vect3& vo, const Vect3& vi,
     const double D, const double H) {
-  double t_in  = PINFINITY;
-  double t_out = NINFINITY;
-  Vect2 s2  = s.vect2();
-  Vect2 vo2 = vo.vect2();
-  Vect2 vi2 = vi.vect2();
-  double vz = vo.z()-vi.z();
+  return Detection3D::separableLossInterval(horizontalLossInterval(s.vect2(),vo.vect2(),vi.vect2(),D),
+      verticalLossInterval(s.z(),vo.z(),vi.z(),H));
+}
+
+Interval CD3D::horizontalLossInterval(const Vect2& s2, const Vect2& vo2, const Vect2& vi2, const double D) {
   if (vo2.almostEquals(vi2) && Horizontal::almost_horizontal_los(s2,D)) {
-    if (!Util::almost_equals(vo.z(),vi.z())) {
-      t_in  = Vertical::Theta_H(s.z(),vz,larcfm::Entry,H);
-      t_out = Vertical::Theta_H(s.z(),vz,larcfm::Exit,H);
-    } else if (Vertical::almost_vertical_los(s.z(),H)) {
-      t_in  = NINFINITY;
-      t_out = PINFINITY;
-    }
-  } else {
-    Vect2 v2 = vo2 - vi2;
-    if (Horizontal::Delta(s2,v2,D) > 0.0) {
-      double td1 = Horizontal::Theta_D(s2,v2,larcfm::Entry,D);
-      double td2 = Horizontal::Theta_D(s2,v2,larcfm::Exit,D);
-      if (!Util::almost_equals(vo.z(),vi.z())) {
-        t_in  = Util::max(td1,Vertical::Theta_H(s.z(),vz,larcfm::Entry,H));
-        t_out = Util::min(td2,Vertical::Theta_H(s.z(),vz,larcfm::Exit,H));
-       } else if (Vertical::almost_vertical_los(s.z(),H)) {
-        t_in  = td1;
-        t_out = td2;
-      }
-    }
+    return Interval(NINFINITY,PINFINITY);
   }
-  return LossData(t_in, t_out);
+  Vect2 v2 = vo2 - vi2;
+  if (Horizontal::Delta(s2,v2,D) > 0.0) {
+    return Interval(Horizontal::Theta_D(s2,v2,larcfm::Entry,D),Horizontal::Theta_D(s2,v2,larcfm::Exit,D));
+  }
+  return Interval::EMPTY;
+}
+
+Interval CD3D::verticalLossInterval(const double sz, const double voz, const double viz, const double H) {
+  if (!Util::almost_equals(voz,viz)) {
+    double vz = voz-viz;
+    return Interval(Vertical::Theta_H(sz,vz,larcfm::Entry,H),Vertical::Theta_H(sz,vz,larcfm::Exit,H));
+  }
+  if (Vertical::almost_vertical_los(sz,H)) {
+    return Interval(NINFINITY,PINFINITY);
+  }
+  return Interval::EMPTY;
 }
 
 bool CD3D::cd3d(const Vect3& s, const Vect3& vo, const Vect3& vi,
@@ -147,6 +147,26 @@ ConflictData CDCylinder::conflictDetection(const Vect3& so, const Vect3& vo, con
   return conflict_detection(so,vo,si,vi,D_,H_,B,T);
 }
 
+bool CDCylinder::hasLossInterval() const {
+  return true;
+}
+
+LossData CDCylinder::lossInterval(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi) const {
+  return CD3D::detectionActual(so.Sub(si),vo,vi,D_,H_);
+}
+
+bool CDCylinder::hasVerticalInterval() const {
+  return true;
+}
+
+Interval CDCylinder::verticalInterval(double sz, double voz, double viz, double B, double T) const {
+  return CD3D::verticalLossInterval(sz,voz,viz,H_);
+}
+
+Interval CDCylinder::horizontalInterval(const Vect2& s, const Vect2& vo, const Vect2& vi) const {
+  return CD3D::horizontalLossInterval(s,vo,vi,D_);
+}
+
 double CDCylinder::time_of_closest_approach(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi, double D, double H, double B, double T) {
   return CD3D::tccpa(so.Sub(si),vo,vi,D,H,B,T);
 }
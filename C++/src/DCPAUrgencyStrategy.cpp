@@ -58,6 +58,42 @@ int DCPAUrgencyStrategy::mostUrgentAircraft(const TrafficState& ownship, const s
   return repac;
 }
 
+/**
+ * @return most urgent traffic aircraft for given ownship, traffic and lookahead time T, where
+ * table contains the states of traffic relative to ownship.
+ * Return -1 if no aircraft is most urgent.
+ */
+int DCPAUrgencyStrategy::mostUrgentAircraft(const TrafficState& ownship, const std::vector<TrafficState>& traffic, const TrafficTable& table, double T) const {
+  (void)T; //bypass unused parameter warning (needed for interface)
+  if (table.size() != static_cast<int>(traffic.size())) {
+    return mostUrgentAircraft(ownship,traffic,T);
+  }
+  int repac = -1;
+  if (!ownship.isValid() || traffic.empty()) {
+    return repac;
+  }
+  double mindcpa = 0;
+  double mintcpa = 0;
+  double D = ACCoRDConfig::NMAC_D;
+  double H = ACCoRDConfig::NMAC_H;
+  const Vect3& vo = ownship.get_v();
+  for (int row = 0; row < table.size(); ++row) {
+    const Vect3& s = table.s[row];
+    double tcpa = CD3D::tccpa(s,vo,table.vi[row],D,H);
+    double dcpa = table.v[row].ScalAdd(tcpa,s).cyl_norm(D,H);
+    // Same selection criteria as above
+    bool tcpa_strategy = Util::almost_equals(tcpa,mintcpa,PRECISION5) ? dcpa < mindcpa : tcpa < mintcpa;
+    bool dcpa_strategy = Util::almost_equals(dcpa,mindcpa,PRECISION5) ? tcpa < mintcpa : dcpa < mindcpa;
+    if (repac < 0 ||
+        (dcpa <= 1 ? mindcpa > 1 || tcpa_strategy : dcpa_strategy)) {
+      repac = table.handle[row];
+      mindcpa = dcpa;
+      mintcpa = tcpa;
+    }
+  }
+  return repac;
+}
+
 UrgencyStrategy* DCPAUrgencyStrategy::copy() const {
   return new DCPAUrgencyStrategy();
 }
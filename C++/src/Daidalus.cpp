@@ -78,8 +78,10 @@
 #include "DaidalusDirBands.h"
 #include "DaidalusHsBands.h"
 #include "DaidalusVsBands.h"
+#include "StateBuffer.h"
 #include <vector>
 #include <cmath>
+#include <sstream>
 #include "TrafficState.h"
 
 namespace larcfm {
@@ -276,6 +278,9 @@ void Daidalus::setOwnshipState(const std::string& id, const Position& pos, const
     core_.set_ownship_state(id,pos,vel,airvel,time);
     stale_bands();
   }
+  if (core_.memory_budget > 0 && memoryUsage().total() > core_.memory_budget) {
+    trimMemory();
+  }
 }
 
 /**
@@ -568,7 +573,7 @@ void Daidalus::setAlerter(int ac_idx, const std::string& alerter) {
  */
 int Daidalus::alerterIndexBasedOnAlertingLogic(int ac_idx) {
   if (0 <= ac_idx && ac_idx <= lastTrafficIndex()) {
-    return core_.alerter_index_of(getAircraftStateAt(ac_idx));
+    return core_.alerter_index_of(ac_idx-1);
   }
   return 0;
 }
@@ -720,6 +725,102 @@ void Daidalus::setUrgencyStrategy(const UrgencyStrategy& strat) {
   reset();
 }
 
+/**
+ * @return executor used for parallel computations, which is Executor::defaultExecutor() unless
+ * one has been set.
+ */
+Executor& Daidalus::getExecutor() const {
+  return core_.getExecutor();
+}
+
+/**
+ * Set executor used for parallel computations. The executor is not copied and it must outlive 
+ * this object.
+ */
+void Daidalus::setExecutor(Executor& executor) {
+  core_.executor = &executor;
+}
+
+/**
+ * @return maximum number of recovery cylinder sizes evaluated concurrently.
+ */
+int Daidalus::getRecoveryThreads() const {
+  return core_.recovery_threads;
+}
+
+/**
+ * Set maximum number of recovery cylinder sizes evaluated concurrently by the executor when
+ * collision avoidance bands are enabled. A value of 1 means that cylinder sizes are evaluated 
+ * one at a time.
+ */
+void Daidalus::setRecoveryThreads(int threads) {
+  core_.recovery_threads = Util::max(1,threads);
+}
+
+/**
+ * @return estimated memory footprint of this object, in bytes, by component
+ */
+MemoryUsage Daidalus::memoryUsage() const {
+  MemoryUsage usage;
+  usage.object = sizeof(Daidalus);
+  core_.memory_usage(usage);
+  hdir_band_.memory_usage(usage);
+  hs_band_.memory_usage(usage);
+  vs_band_.memory_usage(usage);
+  alt_band_.memory_usage(usage);
+  return usage;
+}
+
+/**
+ * @return memory budget in bytes. 0 means no budget.
+ */
+int Daidalus::getMemoryBudget() const {
+  return core_.memory_budget;
+}
+
+/**
+ * Set memory budget in bytes. When an ownship state is set and the estimated memory footprint of this
+ * object exceeds the budget, memory is trimmed. A value of 0 means no budget.
+ */
+void Daidalus::setMemoryBudget(int bytes) {
+  core_.memory_budget = Util::max(0,bytes);
+}
+
+/**
+ * Release memory of stale cached values and remove hysteresis information that would be reset at current time.
+ */
+void Daidalus::trimMemory() {
+  core_.trim_memory();
+  hdir_band_.trim_memory(core_.current_time);
+  hs_band_.trim_memory(core_.current_time);
+  vs_band_.trim_memory(core_.current_time);
+  alt_band_.trim_memory(core_.current_time);
+}
+
+/**
+ * @return mode of computation of instantaneous vertical speed bands for cylinders: 0 (sampled), 
+ * 1 (closed form), or 2 (closed form, cross-checked against sampled bands).
+ */
+int Daidalus::getAnalyticVerticalSpeedBands() const {
+  return vs_band_.get_analytic();
+}
+
+/**
+ * Set mode of computation of instantaneous vertical speed bands when detectors are cylinders: 
+ * 0 (sampled), 1 (closed form), or 2 (closed form, cross-checked against sampled bands).
+ */
+void Daidalus::setAnalyticVerticalSpeedBands(int mode) {
+  vs_band_.set_analytic(mode);
+  vs_band_.stale();
+}
+
+/**
+ * @return number of times closed form and sampled vertical speed bands have disagreed.
+ */
+int Daidalus::analyticVerticalSpeedBandsMismatches() const {
+  return vs_band_.analytic_mismatches();
+}
+
 /**
  * @return most urgent aircraft.
  */
@@ -727,6 +828,25 @@ TrafficState Daidalus::mostUrgentAircraft() {
   return core_.mostUrgentAircraft();
 }
 
+/**
+ * Computes all bands, resolutions, and alerts for the current time step and atomically
+ * publishes them as an immutable snapshot, which replaces the previously published one.
+ * @return the published snapshot
+ */
+std::shared_ptr<const DaidalusResult> Daidalus::publishResult() {
+  std::shared_ptr<const DaidalusResult> result = std::make_shared<const DaidalusResult>(*this);
+  std::atomic_store(&published_,result);
+  return result;
+}
+
+/**
+ * @return last snapshot published by publishResult, or a null pointer if none has been published.
+ * This method can be called from any thread, even while this object is computing the next time step.
+ */
+std::shared_ptr<const DaidalusResult> Daidalus::latestResult() const {
+  return std::atomic_load(&published_);
+}
+
 /* Computation of contours, a.k.a. blobs, and hazard zones */
 
 /**
@@ -2815,6 +2935,22 @@ bool Daidalus::saveToFile(const std::string& file) {
   return core_.parameters.saveToFile(file);
 }
 
+/**
+ *  Write parameters to binary file.
+ */
+bool Daidalus::saveCompiled(const std::string& file, const std::string& source) {
+  return core_.parameters.saveCompiled(file,source);
+}
+
+/**
+ *  Load parameters from binary file.
+ */
+bool Daidalus::loadCompiled(const std::string& file, const std::string& source) {
+  bool flag = core_.parameters.loadCompiled(file,source);
+  clearHysteresis();
+  return flag;
+}
+
 /**
  * Set bands parameters
  */
@@ -2861,6 +2997,52 @@ void Daidalus::clearHysteresis() {
   alt_band_.clear_hysteresis();
 }
 
+// Format of serialized states. Increase this value when the format changes
+static const int STATE_FORMAT = 1;
+
+/**
+ * Write in state a compact binary representation of the runtime state of this object, i.e., ownship
+ * and traffic states, wind, current time, and alerting, DTA, and bands hysteresis information
+ * (M of N windows and persistence). Configuration parameters, urgency strategy, and cached values are not
+ * written. Previous contents of state are replaced, but its allocated memory is reused.
+ * The representation depends on the architecture of the host and on the version of DAIDALUS.
+ */
+void Daidalus::serializeState(std::string& state) const {
+  StateBuffer buf;
+  buf.swap(state);
+  buf.clear();
+  buf.writeString(DaidalusParameters::VERSION);
+  buf.writeInt(STATE_FORMAT);
+  core_.write_state(buf);
+  hdir_band_.write_state(buf);
+  hs_band_.write_state(buf);
+  vs_band_.write_state(buf);
+  alt_band_.write_state(buf);
+  buf.swap(state);
+}
+
+/**
+ * Restore runtime state written by serializeState, possibly by another Daidalus object.
+ * The configuration of this object is expected to be the same as the one of the object that
+ * wrote the state. Return false if state is not valid, in which case ownship, traffic, and hysteresis
+ * information are cleared.
+ */
+bool Daidalus::restoreState(const std::string& state) {
+  StateBuffer buf(state);
+  if (equals(buf.readString(),DaidalusParameters::VERSION) &&
+      buf.readInt() == STATE_FORMAT &&
+      core_.read_state(buf) &&
+      hdir_band_.read_state(buf) &&
+      hs_band_.read_state(buf) &&
+      vs_band_.read_state(buf) &&
+      alt_band_.read_state(buf) &&
+      buf.atEnd()) {
+    return true;
+  }
+  clear();
+  return false;
+}
+
 /**
  *  Clear ownship and traffic state data from this object.
  *  IMPORTANT: This method reset cache and hysteresis parameters.
@@ -3846,7 +4028,7 @@ bool Daidalus::inCorrectiveConflict() {
 ConflictData Daidalus::violationOfAlertThresholds(int ac_idx, int alert_level) {
   if (1 <= ac_idx && ac_idx <= lastTrafficIndex()) {
     const TrafficState& intruder = core_.traffic[ac_idx-1];
-    int alerter_idx = core_.alerter_index_of(intruder);
+    int alerter_idx = core_.alerter_index_of(ac_idx-1);
     if (1 <= alerter_idx && alerter_idx <= core_.parameters.numberOfAlerters()) {
       const Alerter& alerter = core_.parameters.getAlerterAt(alerter_idx);
       if (alert_level == 0) {
@@ -3919,8 +4101,7 @@ double Daidalus::timeToCorrectiveVolume(int ac_idx) {
  */
 BandsRegion::Region Daidalus::regionOfAlertLevel(int ac_idx, int alert_level) {
   if (1 <= ac_idx && ac_idx <= lastTrafficIndex()) {
-    const TrafficState& intruder = core_.traffic[ac_idx-1];
-    int alerter_idx = core_.alerter_index_of(intruder);
+    int alerter_idx = core_.alerter_index_of(ac_idx-1);
     if (1 <= alerter_idx && alerter_idx <= core_.parameters.numberOfAlerters()) {
       if (alert_level == 0) {
           return BandsRegion::NONE;
@@ -3959,8 +4140,7 @@ int Daidalus::alertLevelOfRegion(int ac_idx, int region) {
  */
 int Daidalus::alertLevelOfRegion(int ac_idx, BandsRegion::Region region) {
   if (1 <= ac_idx && ac_idx <= lastTrafficIndex()) {
-    const TrafficState& intruder = core_.traffic[ac_idx-1];
-    int alerter_idx = core_.alerter_index_of(intruder);
+    int alerter_idx = core_.alerter_index_of(ac_idx-1);
     if (1 <= alerter_idx && alerter_idx <= core_.parameters.numberOfAlerters()) {
       const Alerter& alerter = core_.parameters.getAlerterAt(alerter_idx);
       return alerter.alertLevelForRegion(region);
@@ -4262,6 +4442,31 @@ double Daidalus::modifiedTau(int ac_idx, double DMOD, const std::string& DMODu,
   }
 }
 
+/**
+ * Returns DAA performance metrics, in internal units, with aircraft at index ac_idx, including time to 
+ * violation of alert thresholds of every alert level of its alerter. Metrics are computed at most once 
+ * per cycle. Returns invalid metrics if aircraft index is not valid
+ */
+const EncounterMetrics& Daidalus::encounterMetrics(int ac_idx) {
+  if (1 <= ac_idx && ac_idx <= lastTrafficIndex()) {
+    return core_.encounter_metrics(ac_idx-1);
+  } else {
+    error.addError("encounterMetrics: aircraft index "+Fmi(ac_idx)+" is out of bounds");
+    return EncounterMetrics::INVALID();
+  }
+}
+
+/**
+ * Put in table the DAA performance metrics, in internal units, of all traffic aircraft, where 
+ * the i-th row corresponds to the aircraft at index i+1.
+ */
+void Daidalus::encounterMetrics(EncounterMetricsTable& table) {
+  table.clear();
+  for (int ac=1; ac <= lastTrafficIndex(); ++ac) {
+    table.add(core_.traffic[ac-1].getId(),core_.encounter_metrics(ac-1));
+  }
+}
+
 
 /* Input/Output methods */
 
@@ -4284,36 +4489,40 @@ std::string Daidalus::rawString() const {
 }
 
 std::string Daidalus::toString() const {
-  std::string s = "";
-  s = "# Daidalus Object\n";
-  s += core_.parameters.toString();
+  std::ostringstream out;
+  toString(out);
+  return out.str();
+}
+
+void Daidalus::toString(std::ostream& out) const {
+  out << "# Daidalus Object\n";
+  out << core_.parameters.toString();
   if (core_.ownship.isValid()) {
-    s += "###\n"+outputStringAircraftStates();
+    out << "###\n" << outputStringAircraftStates();
     if (core_.isFresh()) {
-      s+=core_.toString();
+      out << core_.toString();
       if (hdir_band_.isFresh()) {
-        s+="## Direction Bands\n";
-        s+=hdir_band_.toString();
+        out << "## Direction Bands\n";
+        hdir_band_.toString(out);
       }
       if (hs_band_.isFresh()) {
-        s+="## Horizontal Speed Bands\n";
-        s+=hs_band_.toString();
+        out << "## Horizontal Speed Bands\n";
+        hs_band_.toString(out);
       }
       if (vs_band_.isFresh()) {
-        s+="## Vertical Speed Bands\n";
-        s+=vs_band_.toString();
+        out << "## Vertical Speed Bands\n";
+        vs_band_.toString(out);
       }
       if (alt_band_.isFresh()) {
-        s+="## Altitude Bands\n";
-        s+=alt_band_.toString();
+        out << "## Altitude Bands\n";
+        alt_band_.toString(out);
       }
     }
   }
   if (hasMessage()) {
-    s += "###\n";
-    s+= getMessageNoClear();
+    out << "###\n";
+    out << getMessageNoClear();
   }
-  return s;
 }
 
 std::string Daidalus::outputStringInfo() {
@@ -4529,15 +4738,19 @@ std::string Daidalus::outputStringLastTimeToManeuver() {
 }
 
 std::string Daidalus::outputString() {
-  std::string s="";
-  s+=outputStringInfo();
-  s+=outputStringAlerting();
-  s+=outputStringDirectionBands();
-  s+=outputStringHorizontalSpeedBands();
-  s+=outputStringVerticalSpeedBands();
-  s+=outputStringAltitudeBands();
-  s+=outputStringLastTimeToManeuver();
-  return s;
+  std::ostringstream out;
+  outputString(out);
+  return out.str();
+}
+
+void Daidalus::outputString(std::ostream& out) {
+  out << outputStringInfo();
+  out << outputStringAlerting();
+  out << outputStringDirectionBands();
+  out << outputStringHorizontalSpeedBands();
+  out << outputStringVerticalSpeedBands();
+  out << outputStringAltitudeBands();
+  out << outputStringLastTimeToManeuver();
 }
 
 std::string Daidalus::toPVS() {
@@ -4545,216 +4758,213 @@ std::string Daidalus::toPVS() {
 }
 
 std::string Daidalus::toPVS(bool parameters) {
+  std::ostringstream out;
+  toPVS(out,parameters);
+  return out.str();
+}
+
+void Daidalus::toPVS(std::ostream& out, bool parameters) {
   bool comma;
-  std::string s="%%% INPUTS %%%\n";
+  out << "%%% INPUTS %%%\n";
   if (parameters) {
-    s += "%%% Parameters:\n"+core_.parameters.toPVS()+"\n";
+    out << "%%% Parameters:\n" << core_.parameters.toPVS() << "\n";
   }
-  s += "%%% Time:\n"+FmPrecision(getCurrentTime())+"\n";
-  s += "%%% Aircraft List:\n"+core_.ownship.listToPVSAircraftList(core_.traffic)+"\n";
-  s += "%%% Most Urgent Aircraft:\n\""+core_.mostUrgentAircraft().getId()+"\"\n";
-  s += "%%% Horizontal Epsilon:\n"+Fmi(core_.epsilonH())+"\n";
-  s += "%%% Vertical Epsilon:\n"+Fmi(core_.epsilonV())+"\n";
-  s += "%%% Bands for Regions:\n";
-  s += "(# ";
+  out << "%%% Time:\n" << FmPrecision(getCurrentTime()) << "\n";
+  out << "%%% Aircraft List:\n" << core_.ownship.listToPVSAircraftList(core_.traffic) << "\n";
+  out << "%%% Most Urgent Aircraft:\n\"" << core_.mostUrgentAircraft().getId() << "\"\n";
+  out << "%%% Horizontal Epsilon:\n" << Fmi(core_.epsilonH()) << "\n";
+  out << "%%% Vertical Epsilon:\n" << Fmi(core_.epsilonV()) << "\n";
+  out << "%%% Bands for Regions:\n";
+  out << "(# ";
   comma = false;
   for (int regidx=1; regidx <= BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++regidx) {
     BandsRegion::Region region = BandsRegion::regionFromOrder(regidx);
     if (comma) {
-      s += ", ";
+      out << ", ";
     } else {
       comma = true;
     }
-    s += BandsRegion::to_string(region)+"_:= "+Fmb(core_.bands_for(BandsRegion::NUMBER_OF_CONFLICT_BANDS-regidx));
+    out << BandsRegion::to_string(region) << "_:= " << Fmb(core_.bands_for(BandsRegion::NUMBER_OF_CONFLICT_BANDS-regidx));
   }
-  s += " #)\n";
-  s += "%%% OUTPUTS %%%\n";
-  s += "%%% Conflict Bands Aircraft (FAR,MID,NEAR):\n";
-  s += "( ";
+  out << " #)\n";
+  out << "%%% OUTPUTS %%%\n";
+  out << "%%% Conflict Bands Aircraft (FAR,MID,NEAR):\n";
+  out << "( ";
   comma = false;
   std::vector<std::string> acs;
   for (int regidx=1; regidx <= BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++regidx) {
     BandsRegion::Region region = BandsRegion::regionFromOrder(regidx);
     if (comma) {
-      s += ", ";
+      out << ", ";
     } else {
       comma = true;
     }
     conflictBandsAircraft(acs,region);
-    s += TrafficState::listToPVSStringList(acs);
+    out << TrafficState::listToPVSStringList(acs);
   }
-  s += " )::[list[string],list[string],list[string]]\n";
-  s += "%%% Region of Current Horizontal Direction:\n"+
-      BandsRegion::to_string(horizontalDirectionRegionAt(indexOfHorizontalDirection(getOwnshipState().horizontalDirection())))+"\n";
-  s += "%%% Horizontal Direction Bands: "+Fmi(horizontalDirectionBandsLength())+"\n";
-  s += hdir_band_.toPVS()+"\n";
-  s += "%%% Peripheral Horizontal Direction Bands Aircraft (FAR,MID,NEAR):\n";
-  s += "( ";
+  out << " )::[list[string],list[string],list[string]]\n";
+  out << "%%% Region of Current Horizontal Direction:\n" << BandsRegion::to_string(horizontalDirectionRegionAt(indexOfHorizontalDirection(getOwnshipState().horizontalDirection()))) << "\n";
+  out << "%%% Horizontal Direction Bands: " << Fmi(horizontalDirectionBandsLength()) << "\n";
+  hdir_band_.toPVS(out);
+  out << "\n";
+  out << "%%% Peripheral Horizontal Direction Bands Aircraft (FAR,MID,NEAR):\n";
+  out << "( ";
   comma = false;
   for (int regidx=1; regidx <= BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++regidx) {
     BandsRegion::Region region = BandsRegion::regionFromOrder(regidx);
     if (comma) {
-      s += ", ";
+      out << ", ";
     } else {
       comma = true;
     }
     peripheralHorizontalDirectionBandsAircraft(acs,region);
-    s += TrafficState::listToPVSStringList(acs);
+    out << TrafficState::listToPVSStringList(acs);
   }
-  s += " )::[list[string],list[string],list[string]]\n";
-  s += "%%% Horizontal Direction Resolution:\n";
-  s += "("+double2PVS(horizontalDirectionResolution(false))+
-      ","+double2PVS(horizontalDirectionResolution(true))+
-      ","+Fmb(preferredHorizontalDirectionRightOrLeft())+")\n";
+  out << " )::[list[string],list[string],list[string]]\n";
+  out << "%%% Horizontal Direction Resolution:\n";
+  out << "(" << double2PVS(horizontalDirectionResolution(false)) << "," << double2PVS(horizontalDirectionResolution(true)) << "," << Fmb(preferredHorizontalDirectionRightOrLeft()) << ")\n";
   RecoveryInformation recovery = horizontalDirectionRecoveryInformation();
-  s += "%%% Horizontal Recovery Information:\n"+recovery.toPVS()+"\n";
-  s += "%%% Last Times to Direction Maneuver wrt Traffic Aircraft:\n(:";
+  out << "%%% Horizontal Recovery Information:\n" << recovery.toPVS() << "\n";
+  out << "%%% Last Times to Direction Maneuver wrt Traffic Aircraft:\n(:";
   comma = false;
   for (int ac_idx = 0; ac_idx < static_cast<int>(core_.traffic.size()); ++ac_idx) {
     if (comma) {
-      s += ",";
+      out << ",";
     } else {
       comma = true;
     }
-    s += " "+double2PVS(lastTimeToHorizontalDirectionManeuver(core_.traffic[ac_idx]));
+    out << " " << double2PVS(lastTimeToHorizontalDirectionManeuver(core_.traffic[ac_idx]));
   }
-  s += " :)\n";
-
-  s += "%%% Region of Current Horizontal Speed:\n"+
-      BandsRegion::to_string(horizontalSpeedRegionAt(indexOfHorizontalSpeed(getOwnshipState().horizontalSpeed())))+"\n";
-  s += "%%% Horizontal Speed Bands: "+Fmi(horizontalSpeedBandsLength())+"\n";
-  s += hs_band_.toPVS()+"\n";
-  s += "%%% Peripheral Horizontal Speed Bands Aircraft (FAR,MID,NEAR):\n";
-  s += "( ";
+  out << " :)\n";
+
+  out << "%%% Region of Current Horizontal Speed:\n" << BandsRegion::to_string(horizontalSpeedRegionAt(indexOfHorizontalSpeed(getOwnshipState().horizontalSpeed()))) << "\n";
+  out << "%%% Horizontal Speed Bands: " << Fmi(horizontalSpeedBandsLength()) << "\n";
+  hs_band_.toPVS(out);
+  out << "\n";
+  out << "%%% Peripheral Horizontal Speed Bands Aircraft (FAR,MID,NEAR):\n";
+  out << "( ";
   comma = false;
   for (int regidx=1; regidx <= BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++regidx) {
     BandsRegion::Region region = BandsRegion::regionFromOrder(regidx);
     if (comma) {
-      s += ", ";
+      out << ", ";
     } else {
       comma = true;
     }
     peripheralHorizontalSpeedBandsAircraft(acs,region);
-    s += TrafficState::listToPVSStringList(acs);
+    out << TrafficState::listToPVSStringList(acs);
   }
-  s += " )::[list[string],list[string],list[string]]\n";
-  s += "%%% Horizontal Speed Resolution:\n";
-  s += "("+double2PVS(horizontalSpeedResolution(false))+
-      ","+double2PVS(horizontalSpeedResolution(true))+
-      ","+Fmb(preferredHorizontalSpeedUpOrDown())+")\n";
+  out << " )::[list[string],list[string],list[string]]\n";
+  out << "%%% Horizontal Speed Resolution:\n";
+  out << "(" << double2PVS(horizontalSpeedResolution(false)) << "," << double2PVS(horizontalSpeedResolution(true)) << "," << Fmb(preferredHorizontalSpeedUpOrDown()) << ")\n";
   recovery = horizontalSpeedRecoveryInformation();
-  s += "%%% Horizontal Speed Information:\n"+recovery.toPVS()+"\n";
-  s += "%%% Last Times to Horizontal Speed Maneuver wrt Traffic Aircraft:\n(:";
+  out << "%%% Horizontal Speed Information:\n" << recovery.toPVS() << "\n";
+  out << "%%% Last Times to Horizontal Speed Maneuver wrt Traffic Aircraft:\n(:";
   comma = false;
   for (int ac_idx = 0; ac_idx < static_cast<int>(core_.traffic.size()); ++ac_idx) {
     if (comma) {
-      s += ",";
+      out << ",";
     } else {
       comma = true;
     }
-    s += " "+double2PVS(lastTimeToHorizontalSpeedManeuver(core_.traffic[ac_idx]));
+    out << " " << double2PVS(lastTimeToHorizontalSpeedManeuver(core_.traffic[ac_idx]));
   }
-  s += " :)\n";
-
-  s += "%%% Region of Current Vertical Speed:\n"+
-      BandsRegion::to_string(verticalSpeedRegionAt(indexOfVerticalSpeed(getOwnshipState().verticalSpeed())))+"\n";
-  s += "%%% Vertical Speed Bands: "+Fmi(verticalSpeedBandsLength())+"\n";
-  s += vs_band_.toPVS()+"\n";
-  s += "%%% Peripheral Vertical Speed Bands Aircraft (FAR,MID,NEAR):\n";
-  s += "( ";
+  out << " :)\n";
+
+  out << "%%% Region of Current Vertical Speed:\n" << BandsRegion::to_string(verticalSpeedRegionAt(indexOfVerticalSpeed(getOwnshipState().verticalSpeed()))) << "\n";
+  out << "%%% Vertical Speed Bands: " << Fmi(verticalSpeedBandsLength()) << "\n";
+  vs_band_.toPVS(out);
+  out << "\n";
+  out << "%%% Peripheral Vertical Speed Bands Aircraft (FAR,MID,NEAR):\n";
+  out << "( ";
   comma = false;
   for (int regidx=1; regidx <= BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++regidx) {
     BandsRegion::Region region = BandsRegion::regionFromOrder(regidx);
     if (comma) {
-      s += ", ";
+      out << ", ";
     } else {
       comma = true;
     }
     peripheralVerticalSpeedBandsAircraft(acs,region);
-    s += TrafficState::listToPVSStringList(acs);
+    out << TrafficState::listToPVSStringList(acs);
   }
-  s += " )::[list[string],list[string],list[string]]\n";
-  s += "%%% Vertical Speed Resolution:\n";
-  s += "("+double2PVS(verticalSpeedResolution(false))+
-      ","+double2PVS(verticalSpeedResolution(true))+
-      ","+Fmb(preferredVerticalSpeedUpOrDown())+")\n";
+  out << " )::[list[string],list[string],list[string]]\n";
+  out << "%%% Vertical Speed Resolution:\n";
+  out << "(" << double2PVS(verticalSpeedResolution(false)) << "," << double2PVS(verticalSpeedResolution(true)) << "," << Fmb(preferredVerticalSpeedUpOrDown()) << ")\n";
   recovery = verticalSpeedRecoveryInformation();
-  s += "%%% Vertical Speed Information:\n"+recovery.toPVS()+"\n";
-  s += "%%% Last Times to Vertical Speed Maneuver wrt Traffic Aircraft:\n(:";
+  out << "%%% Vertical Speed Information:\n" << recovery.toPVS() << "\n";
+  out << "%%% Last Times to Vertical Speed Maneuver wrt Traffic Aircraft:\n(:";
   comma = false;
   for (int ac_idx = 0; ac_idx < static_cast<int>(core_.traffic.size()); ++ac_idx) {
     if (comma) {
-      s += ",";
+      out << ",";
     } else {
       comma = true;
     }
-    s += " "+double2PVS(lastTimeToVerticalSpeedManeuver(core_.traffic[ac_idx]));
+    out << " " << double2PVS(lastTimeToVerticalSpeedManeuver(core_.traffic[ac_idx]));
   }
-  s += " :)\n";
-
-  s += "%%% Region of Current Altitude:\n"+
-      BandsRegion::to_string(altitudeRegionAt(indexOfAltitude(getOwnshipState().altitude())))+"\n";
-  s += "%%% Altitude Bands: "+Fmi(altitudeBandsLength())+"\n";
-  s += alt_band_.toPVS()+"\n";
-  s += "%%% Peripheral Altitude Bands Aircraft (FAR,MID,NEAR):\n";
-  s += "( ";
+  out << " :)\n";
+
+  out << "%%% Region of Current Altitude:\n" << BandsRegion::to_string(altitudeRegionAt(indexOfAltitude(getOwnshipState().altitude()))) << "\n";
+  out << "%%% Altitude Bands: " << Fmi(altitudeBandsLength()) << "\n";
+  alt_band_.toPVS(out);
+  out << "\n";
+  out << "%%% Peripheral Altitude Bands Aircraft (FAR,MID,NEAR):\n";
+  out << "( ";
   comma = false;
   for (int regidx=1; regidx <= BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++regidx) {
     BandsRegion::Region region = BandsRegion::regionFromOrder(regidx);
     if (comma) {
-      s += ", ";
+      out << ", ";
     } else {
       comma = true;
     }
     peripheralAltitudeBandsAircraft(acs,region);
-    s += TrafficState::listToPVSStringList(acs);
+    out << TrafficState::listToPVSStringList(acs);
   }
-  s += " )::[list[string],list[string],list[string]]\n";
-  s += "%%% Altitude Resolution:\n";
-  s += "("+double2PVS(altitudeResolution(false))+
-      ","+double2PVS(altitudeResolution(true))+
-      ","+Fmb(preferredAltitudeUpOrDown())+")\n";
+  out << " )::[list[string],list[string],list[string]]\n";
+  out << "%%% Altitude Resolution:\n";
+  out << "(" << double2PVS(altitudeResolution(false)) << "," << double2PVS(altitudeResolution(true)) << "," << Fmb(preferredAltitudeUpOrDown()) << ")\n";
   recovery = altitudeRecoveryInformation();
-  s += "%%% Altitude Information:\n"+recovery.toPVS()+"\n";
-  s += "%%% Last Times to Altitude Maneuver wrt Traffic Aircraft:\n(:";
+  out << "%%% Altitude Information:\n" << recovery.toPVS() << "\n";
+  out << "%%% Last Times to Altitude Maneuver wrt Traffic Aircraft:\n(:";
   comma = false;
   for (int ac_idx = 0; ac_idx < static_cast<int>(core_.traffic.size()); ++ac_idx) {
     if (comma) {
-      s += ",";
+      out << ",";
     } else {
       comma = true;
     }
-    s += " "+double2PVS(lastTimeToAltitudeManeuver(core_.traffic[ac_idx]));
+    out << " " << double2PVS(lastTimeToAltitudeManeuver(core_.traffic[ac_idx]));
   }
-  s += " :)\n";
+  out << " :)\n";
 
-  s += "%%% Time to Corrective Volume:\n";
-  s += "(: ";
+  out << "%%% Time to Corrective Volume:\n";
+  out << "(: ";
   comma = false;
   for (int ac=1; ac <= lastTrafficIndex(); ++ac) {
     if (comma) {
-      s += ", ";
+      out << ", ";
     } else {
       comma = true;
     }
     ConflictData conf = violationOfCorrectiveThresholds(ac);
-    s += "("+FmPrecision(conf.getTimeIn())+","+FmPrecision(conf.getTimeOut())+")";
+    out << "(" << FmPrecision(conf.getTimeIn()) << "," << FmPrecision(conf.getTimeOut()) << ")";
   }
-  s += " :)\n";
+  out << " :)\n";
 
-  s += "%%% Alerting:\n";
-  s += "(: ";
+  out << "%%% Alerting:\n";
+  out << "(: ";
   comma = false;
   for (int ac=1; ac <= lastTrafficIndex(); ++ac) {
     if (comma) {
-      s += ", ";
+      out << ", ";
     } else {
       comma = true;
     }
-    s += "(\""+core_.traffic[ac-1].getId()+"\","+Fmi(alertLevel(ac))+")";
+    out << "(\"" << core_.traffic[ac-1].getId() << "\"," << Fmi(alertLevel(ac)) << ")";
   }
-  s += " :)\n";
-  return s;
+  out << " :)\n";
 }
 
 // ErrorReporter Interface Methods
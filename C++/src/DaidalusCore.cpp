@@ -21,9 +21,14 @@
 #include <string>
 #include <cmath>
 #include "TrafficState.h"
+#include "Projection.h"
+#include "GreatCircle.h"
 
 namespace larcfm {
 
+// Slack, in meters, used to absorb rounding errors in the projected DTA containment check
+static const double DTA_PROJECTION_SLACK = 1E-6;
+
 DaidalusCore::DaidalusCore()
 : ownship()
 , traffic()
@@ -31,6 +36,9 @@ DaidalusCore::DaidalusCore()
 , wind_vector()
 , parameters()
 , urgency_strategy(new NoneUrgencyStrategy())
+, recovery_threads(1)
+, executor(NULL)
+, memory_budget(0)
 , cache_(0) // Cached_ variables are cleared
 , acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS)) {
   stale();
@@ -43,6 +51,9 @@ DaidalusCore::DaidalusCore(const Alerter& alerter)
 , wind_vector()
 , parameters()
 , urgency_strategy(new NoneUrgencyStrategy())
+, recovery_threads(1)
+, executor(NULL)
+, memory_budget(0)
 , cache_(0) // Cached_ variables are cleared
 , acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS)) {
   parameters.addAlerter(alerter);
@@ -56,6 +67,9 @@ DaidalusCore::DaidalusCore(const Detection3D& det, double T)
 , wind_vector()
 , parameters()
 , urgency_strategy(new NoneUrgencyStrategy())
+, recovery_threads(1)
+, executor(NULL)
+, memory_budget(0)
 , cache_(0) // Cached_ variables are cleared
 , acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS)) {
   parameters.addAlerter(Alerter::SingleBands(det,T,T));
@@ -70,6 +84,9 @@ DaidalusCore::DaidalusCore(const DaidalusCore& core)
 , wind_vector(core.wind_vector)
 , parameters(core.parameters)
 , urgency_strategy(core.urgency_strategy->copy())
+, recovery_threads(core.recovery_threads)
+, executor(core.executor)
+, memory_budget(core.memory_budget)
 , cache_(0) // Cached_ variables are cleared
 , acs_conflict_bands_(std::vector<std::vector<IndexLevelT> >(BandsRegion::NUMBER_OF_CONFLICT_BANDS)) {
   stale();
@@ -83,6 +100,9 @@ void DaidalusCore::copyFrom(const DaidalusCore& core) {
     wind_vector = core.wind_vector;
     parameters = core.parameters;
     urgency_strategy.reset(core.urgency_strategy->copy());
+    recovery_threads = core.recovery_threads;
+    executor = core.executor;
+    memory_budget = core.memory_budget;
     // Cached_ variables are cleared
     cache_ = 0;
     stale();
@@ -140,11 +160,186 @@ void DaidalusCore::clear_hysteresis() {
   stale();
 }
 
+static void write_position(StateBuffer& buf, const Position& pos) {
+  buf.writeBool(pos.isLatLon());
+  if (pos.isLatLon()) {
+    buf.writeDouble(pos.lat());
+    buf.writeDouble(pos.lon());
+    buf.writeDouble(pos.alt());
+  } else {
+    buf.writeDouble(pos.x());
+    buf.writeDouble(pos.y());
+    buf.writeDouble(pos.z());
+  }
+}
+
+static Position read_position(StateBuffer& buf) {
+  bool latlon = buf.readBool();
+  double a = buf.readDouble();
+  double b = buf.readDouble();
+  double c = buf.readDouble();
+  return latlon ? Position::mkLatLonAlt(a,b,c) : Position::mkXYZ(a,b,c);
+}
+
+// Track and ground speed are written, since they are kept when velocity is 0
+static void write_velocity(StateBuffer& buf, const Velocity& vel) {
+  buf.writeDouble(vel.trk());
+  buf.writeDouble(vel.gs());
+  buf.writeVect3(vel.vect3());
+}
+
+static Velocity read_velocity(StateBuffer& buf) {
+  double trk = buf.readDouble();
+  double gs = buf.readDouble();
+  Vect3 v = buf.readVect3();
+  return Velocity::mkTrkGsVxyz(trk,gs,v.x(),v.y(),v.z());
+}
+
+static void write_aircraft(StateBuffer& buf, const TrafficState& ac) {
+  buf.writeString(ac.getId());
+  write_position(buf,ac.getPosition());
+  write_velocity(buf,ac.getGroundVelocity());
+  write_velocity(buf,ac.getAirVelocity());
+  buf.writeInt(ac.getAlerterIndex());
+  const SUMData& sum = ac.sum();
+  buf.writeDouble(sum.get_s_EW_std());
+  buf.writeDouble(sum.get_s_NS_std());
+  buf.writeDouble(sum.get_s_EN_std());
+  buf.writeDouble(sum.get_sz_std());
+  buf.writeDouble(sum.get_v_EW_std());
+  buf.writeDouble(sum.get_v_NS_std());
+  buf.writeDouble(sum.get_v_EN_std());
+  buf.writeDouble(sum.get_vz_std());
+}
+
+// Read aircraft written by write_aircraft. If ownship is valid, the aircraft is read as an intruder
+// of ownship. Otherwise, it is read as an ownship. Flag an error in buf if aircraft is not valid.
+static TrafficState read_aircraft(StateBuffer& buf, const TrafficState& ownship) {
+  std::string id = buf.readString();
+  Position pos = read_position(buf);
+  Velocity vel = read_velocity(buf);
+  Velocity airvel = read_velocity(buf);
+  int alerter = buf.readInt();
+  double sum[8];
+  for (int i=0; i < 8; ++i) {
+    sum[i] = buf.readDouble();
+  }
+  if (buf.hasError()) {
+    return TrafficState::INVALID();
+  }
+  TrafficState ac;
+  if (ownship.isValid()) {
+    ac = ownship.makeIntruder(id,pos,vel);
+    ac.resetAirVelocity(airvel);
+  } else {
+    ac = TrafficState::makeOwnship(id,pos,vel,airvel);
+  }
+  if (!ac.isValid()) {
+    buf.setError();
+    return TrafficState::INVALID();
+  }
+  ac.setAlerterIndex(alerter);
+  ac.setHorizontalPositionUncertainty(sum[0],sum[1],sum[2]);
+  ac.setVerticalPositionUncertainty(sum[3]);
+  ac.setHorizontalVelocityUncertainty(sum[4],sum[5],sum[6]);
+  ac.setVerticalSpeedUncertainty(sum[7]);
+  return ac;
+}
+
+static void write_hysteresis_map(StateBuffer& buf, const std::map<std::string,HysteresisData>& hysteresis_acs) {
+  buf.writeInt(hysteresis_acs.size());
+  std::map<std::string,HysteresisData>::const_iterator hysteresis_ptr;
+  for (hysteresis_ptr = hysteresis_acs.begin(); hysteresis_ptr != hysteresis_acs.end(); ++hysteresis_ptr) {
+    buf.writeString(hysteresis_ptr->first);
+    hysteresis_ptr->second.writeState(buf);
+  }
+}
+
+static void read_hysteresis_map(StateBuffer& buf, std::map<std::string,HysteresisData>& hysteresis_acs) {
+  int size = buf.readCount(sizeof(int));
+  for (int i=0; i < size && !buf.hasError(); ++i) {
+    std::string id = buf.readString();
+    hysteresis_acs[id].readState(buf);
+  }
+}
+
+/**
+ * Write into buf ownship and traffic states, wind, current time, and hysteresis information
+ * of this object. Parameters and cached values are not written.
+ */
+void DaidalusCore::write_state(StateBuffer& buf) const {
+  buf.writeDouble(current_time);
+  buf.writeVect3(wind_vector);
+  buf.writeBool(ownship.isValid());
+  if (ownship.isValid()) {
+    write_aircraft(buf,ownship);
+  }
+  buf.writeInt(traffic.size());
+  for (int ac=0; ac < static_cast<int>(traffic.size()); ++ac) {
+    write_aircraft(buf,traffic[ac]);
+  }
+  write_hysteresis_map(buf,alerting_hysteresis_acs_);
+  write_hysteresis_map(buf,dta_hysteresis_acs_);
+  below_min_as_hysteresis_.writeState(buf);
+}
+
+/**
+ * Read from buf information written by write_state. Return false, without modifying
+ * this object, if buf has an error.
+ */
+bool DaidalusCore::read_state(StateBuffer& buf) {
+  double time = buf.readDouble();
+  Vect3 wind = buf.readVect3();
+  TrafficState own;
+  if (buf.readBool()) {
+    own = read_aircraft(buf,TrafficState::INVALID());
+  }
+  std::vector<TrafficState> acs;
+  int size = buf.readCount(1);
+  if (size > 0 && !own.isValid()) {
+    buf.setError();
+  }
+  for (int ac=0; ac < size && !buf.hasError(); ++ac) {
+    acs.push_back(read_aircraft(buf,own));
+  }
+  std::map<std::string,HysteresisData> alerting_hysteresis_acs;
+  std::map<std::string,HysteresisData> dta_hysteresis_acs;
+  HysteresisData below_min_as_hysteresis;
+  read_hysteresis_map(buf,alerting_hysteresis_acs);
+  read_hysteresis_map(buf,dta_hysteresis_acs);
+  below_min_as_hysteresis.readState(buf);
+  if (buf.hasError()) {
+    return false;
+  }
+  current_time = time;
+  wind_vector = wind;
+  ownship = own;
+  traffic.swap(acs);
+  alerting_hysteresis_acs_.swap(alerting_hysteresis_acs);
+  dta_hysteresis_acs_.swap(dta_hysteresis_acs);
+  below_min_as_hysteresis_ = below_min_as_hysteresis;
+  stale();
+  return true;
+}
+
+/**
+ * @return executor used for parallel computations
+ */
+Executor& DaidalusCore::getExecutor() const {
+  return executor != NULL ? *executor : Executor::defaultExecutor();
+}
+
 /**
  * Set cached values to stale conditions as they are no longer fresh.
  * If hysteresis is true, it also clears hysteresis variables
  */
 void DaidalusCore::stale() {
+  // DTA cached values, encounter metrics, and traffic table are indexed by traffic position, so they are always cleared
+  dta_acs_.clear();
+  encounter_metrics_.clear();
+  encounter_metrics_ready_.clear();
+  traffic_table_ready_ = false;
+  dta_center_status_ = -1;
   if (cache_ >= 0) {
     cache_ = -1;
     most_urgent_ac_ = TrafficState::INVALID();
@@ -153,6 +348,8 @@ void DaidalusCore::stale() {
     special_band_flags_.reset();
     for (int conflict_region=0; conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++conflict_region) {
       acs_conflict_bands_[conflict_region].clear();
+      conflict_data_[conflict_region].clear();
+      conflict_data_ready_[conflict_region].clear();
       tiov_[conflict_region] = Interval::EMPTY;
       bands4region_[conflict_region] = false;
     }
@@ -174,6 +371,70 @@ bool DaidalusCore::isFresh() const {
   return cache_ > 0;
 }
 
+static int hysteresis_map_memory_usage(const std::map<std::string,HysteresisData>& hysteresis_acs) {
+  int bytes = MemoryUsage::map_bytes(hysteresis_acs);
+  std::map<std::string,HysteresisData>::const_iterator hysteresis_ptr;
+  for (hysteresis_ptr = hysteresis_acs.begin(); hysteresis_ptr != hysteresis_acs.end(); ++hysteresis_ptr) {
+    bytes += MemoryUsage::string_bytes(hysteresis_ptr->first)+hysteresis_ptr->second.memoryUsage();
+  }
+  return bytes;
+}
+
+void DaidalusCore::memory_usage(MemoryUsage& usage) const {
+  usage.parameters += parameters.memoryUsage();
+  usage.traffic += MemoryUsage::string_bytes(ownship.getId())+MemoryUsage::vector_bytes(traffic)+
+      MemoryUsage::string_bytes(most_urgent_ac_.getId())+traffic_table_.memoryUsage();
+  for (int ac=0; ac < static_cast<int>(traffic.size()); ++ac) {
+    usage.traffic += MemoryUsage::string_bytes(traffic[ac].getId());
+  }
+  usage.alerting_hysteresis += hysteresis_map_memory_usage(alerting_hysteresis_acs_)+
+      hysteresis_map_memory_usage(dta_hysteresis_acs_)+below_min_as_hysteresis_.memoryUsage();
+  usage.core_caches += MemoryUsage::vector_bytes(acs_conflict_bands_)+MemoryUsage::vector_bytes(dta_acs_)+
+      MemoryUsage::vector_bytes(encounter_metrics_)+MemoryUsage::vector_bytes(encounter_metrics_ready_);
+  for (int conflict_region=0; conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++conflict_region) {
+    usage.core_caches += MemoryUsage::vector_bytes(acs_conflict_bands_[conflict_region])+
+        MemoryUsage::vector_bytes(conflict_data_[conflict_region])+
+        MemoryUsage::vector_bytes(conflict_data_ready_[conflict_region]);
+  }
+}
+
+void DaidalusCore::trim_memory() {
+  std::map<std::string,HysteresisData>::iterator hysteresis_ptr = alerting_hysteresis_acs_.begin();
+  while (hysteresis_ptr != alerting_hysteresis_acs_.end()) {
+    if (hysteresis_ptr->second.isExpired(current_time) && hysteresis_ptr->second.getLastValue() <= 0) {
+      alerting_hysteresis_acs_.erase(hysteresis_ptr++);
+    } else {
+      ++hysteresis_ptr;
+    }
+  }
+  hysteresis_ptr = dta_hysteresis_acs_.begin();
+  while (hysteresis_ptr != dta_hysteresis_acs_.end()) {
+    if (hysteresis_ptr->second.isExpired(current_time)) {
+      dta_hysteresis_acs_.erase(hysteresis_ptr++);
+    } else {
+      ++hysteresis_ptr;
+    }
+  }
+  // Stale caches are empty, but they keep the memory of previous cycles
+  if (!isFresh()) {
+    for (int conflict_region=0; conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++conflict_region) {
+      std::vector<IndexLevelT>().swap(acs_conflict_bands_[conflict_region]);
+      std::vector<ConflictData>().swap(conflict_data_[conflict_region]);
+      std::vector<bool>().swap(conflict_data_ready_[conflict_region]);
+    }
+  }
+  if (dta_acs_.empty()) {
+    std::vector<int>().swap(dta_acs_);
+  }
+  if (encounter_metrics_.empty()) {
+    std::vector<EncounterMetrics>().swap(encounter_metrics_);
+    std::vector<bool>().swap(encounter_metrics_ready_);
+  }
+  if (!traffic_table_ready_) {
+    traffic_table_.release();
+  }
+}
+
 /**
  *  Refresh cached values
  */
@@ -184,24 +445,19 @@ void DaidalusCore::refresh() {
     }
     for (int conflict_region=0; conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++conflict_region) {
       conflict_aircraft(conflict_region);
-      BandsRegion::Region region = BandsRegion::regionFromOrder(BandsRegion::NUMBER_OF_CONFLICT_BANDS-conflict_region);
-      for (int alerter_idx=1;  alerter_idx <= parameters.numberOfAlerters(); ++alerter_idx) {
-        const Alerter& alerter = parameters.getAlerterAt(alerter_idx);
-        int alert_level = alerter.alertLevelForRegion(region);
-        if (alert_level > 0) {
-          bands4region_[conflict_region] = true;
-        }
+      if (parameters.hasAlertLevelForConflictRegion(conflict_region)) {
+        bands4region_[conflict_region] = true;
       }
     }
     int dta_status = 0; // Not active
     if (parameters.getDTALogic() != 0 && parameters.getDTAAlerter() != 0) {
       if (parameters.isAlertingLogicOwnshipCentric()) {
-        if (alerter_index_of(ownship) == parameters.getDTAAlerter()) { // Hysteresis for dta is done here
+        if (alerter_index_of(-1) == parameters.getDTAAlerter()) { // Hysteresis for dta is done here
           dta_status = -1; // Inside DTA
         }
       } else {
         for (int ac=0; ac < static_cast<int>(traffic.size()) && dta_status == 0; ++ac) {
-          if (alerter_index_of(traffic[ac]) == parameters.getDTAAlerter()) { // Hysteresis for dta is done here
+          if (alerter_index_of(ac) == parameters.getDTAAlerter()) { // Hysteresis for dta is done here
             dta_status = -1; // Inside DTA
           }
         }
@@ -233,7 +489,7 @@ void DaidalusCore::refresh_mua_eps() {
   if (cache_ < 0) {
     int muac = -1;
     if (!traffic.empty()) {
-      muac = urgency_strategy->mostUrgentAircraft(ownship, traffic, parameters.getLookaheadTime());
+      muac = urgency_strategy->mostUrgentAircraft(ownship, traffic, traffic_table(), parameters.getLookaheadTime());
     }
     if (muac >= 0) {
       most_urgent_ac_ = traffic[muac];
@@ -474,7 +730,7 @@ bool DaidalusCore::has_traffic() const {
  */
 int DaidalusCore::horizontal_contours(std::vector<std::vector<Position> >& blobs, int idx, int alert_level) {
   const TrafficState& intruder = traffic[idx];
-  int alerter_idx = alerter_index_of(intruder);
+  int alerter_idx = alerter_index_of(idx);
   if (1 <= alerter_idx && alerter_idx <= parameters.numberOfAlerters()) {
     const Alerter& alerter = parameters.getAlerterAt(alerter_idx);
     if (alert_level == 0) {
@@ -507,7 +763,7 @@ int DaidalusCore::horizontal_contours(std::vector<std::vector<Position> >& blobs
 int DaidalusCore::horizontal_hazard_zone(std::vector<Position>& haz, int idx, int alert_level,
     bool loss, bool from_ownship) {
   const TrafficState& intruder = traffic[idx];
-  int alerter_idx = alerter_index_of(intruder);
+  int alerter_idx = alerter_index_of(idx);
   if (1 <= alerter_idx && alerter_idx <= parameters.numberOfAlerters()) {
     const Alerter& alerter = parameters.getAlerterAt(alerter_idx);
     if (alert_level == 0) {
@@ -541,34 +797,32 @@ int DaidalusCore::horizontal_hazard_zone(std::vector<Position>& haz, int idx, in
 void DaidalusCore::conflict_aircraft(int conflict_region) {
   double tin  = PINFINITY;
   double tout = NINFINITY;
+  conflict_data_[conflict_region].assign(traffic.size(),ConflictData());
+  conflict_data_ready_[conflict_region].assign(traffic.size(),false);
   // Iterate on all traffic aircraft
   for (int ac = 0; ac < static_cast<int>(traffic.size()); ++ac) {
     const TrafficState& intruder = traffic[ac];
-    int alerter_idx = alerter_index_of(intruder);
-    if (1 <= alerter_idx && alerter_idx <= parameters.numberOfAlerters()) {
-      const Alerter& alerter = parameters.getAlerterAt(alerter_idx);
-      // Assumes that thresholds of severe alerts are included in the volume of less severe alerts
-      BandsRegion::Region region = BandsRegion::regionFromOrder(BandsRegion::NUMBER_OF_CONFLICT_BANDS-conflict_region);
-      int alert_level = alerter.alertLevelForRegion(region);
-      if (alert_level > 0) {
-        const Detection3D& detector =  alerter.getLevel(alert_level).getCoreDetection();
-        if (detector.isValid()) {
-          std::map<std::string,HysteresisData>::iterator alerting_hysteresis_ptr = alerting_hysteresis_acs_.find(intruder.getId());
-          double alerting_time = alerter.getLevel(alert_level).getAlertingTime();
-          if (alerting_hysteresis_ptr != alerting_hysteresis_acs_.end() &&
-              !ISNAN(alerting_hysteresis_ptr->second.getInitTime()) &&
-              alerting_hysteresis_ptr->second.getInitTime() < current_time &&
-              alerting_hysteresis_ptr->second.getLastValue() == alert_level) {
-            alerting_time = alerter.getLevel(alert_level).getEarlyAlertingTime();
-          }
-          ConflictData det = detector.conflictDetectionWithTrafficState(ownship,intruder,0.0,parameters.getLookaheadTime());
-          if (det.conflict()) {
-            if (det.conflictBefore(alerting_time)) {
-              acs_conflict_bands_[conflict_region].push_back(IndexLevelT(ac,alert_level,parameters.getLookaheadTime()));
-            }
-            tin = Util::min(tin,det.getTimeIn());
-            tout = Util::max(tout,det.getTimeOut());
+    int alerter_idx = alerter_index_of(ac);
+    // Assumes that thresholds of severe alerts are included in the volume of less severe alerts
+    int alert_level = parameters.alertLevelForConflictRegion(alerter_idx,conflict_region);
+    if (alert_level > 0) {
+      const Detection3D& detector = parameters.getAlerterAt(alerter_idx).getLevel(alert_level).getCoreDetection();
+      if (detector.isValid()) {
+        std::map<std::string,HysteresisData>::iterator alerting_hysteresis_ptr = alerting_hysteresis_acs_.find(intruder.getId());
+        bool early = alerting_hysteresis_ptr != alerting_hysteresis_acs_.end() &&
+            !ISNAN(alerting_hysteresis_ptr->second.getInitTime()) &&
+            alerting_hysteresis_ptr->second.getInitTime() < current_time &&
+            alerting_hysteresis_ptr->second.getLastValue() == alert_level;
+        double alerting_time = parameters.alertingTimeForConflictRegion(alerter_idx,conflict_region,early);
+        ConflictData det = detector.conflictDetectionWithTrafficState(ownship,intruder,0.0,parameters.getLookaheadTime());
+        conflict_data_[conflict_region][ac] = det;
+        conflict_data_ready_[conflict_region][ac] = true;
+        if (det.conflict()) {
+          if (det.conflictBefore(alerting_time)) {
+            acs_conflict_bands_[conflict_region].push_back(IndexLevelT(ac,alert_level,parameters.getLookaheadTime()));
           }
+          tin = Util::min(tin,det.getTimeIn());
+          tout = Util::max(tout,det.getTimeOut());
         }
       }
     }
@@ -598,7 +852,78 @@ const Interval& DaidalusCore::tiov(int conflict_region) {
   return tiov_[conflict_region];
 }
 
-int DaidalusCore::dta_hysteresis_current_value(const TrafficState& ac) {
+/**
+ * Requires 0 <= conflict_region < CONFICT_BANDS and idx is a 0-based index in the traffic list
+ * Put in det the conflict detection of the idx-th aircraft for the given conflict region. Return false 
+ * if the detection was not computed in the current cycle.
+ * INTERNAL USE ONLY
+ */
+bool DaidalusCore::conflict_detection(ConflictData& det, int conflict_region, int idx) {
+  refresh();
+  if (0 <= idx && idx < static_cast<int>(conflict_data_ready_[conflict_region].size()) &&
+      conflict_data_ready_[conflict_region][idx]) {
+    det = conflict_data_[conflict_region][idx];
+    return true;
+  }
+  return false;
+}
+
+/**
+ * Requires idx is a 0-based index in the traffic list
+ * @return encounter metrics of the idx-th aircraft. Metrics are computed at most once per cycle
+ * and violations of alert thresholds reuse the conflict detections computed for conflict bands.
+ * INTERNAL USE ONLY
+ */
+const EncounterMetrics& DaidalusCore::encounter_metrics(int idx) {
+  if (idx < 0 || idx >= static_cast<int>(traffic.size())) {
+    return EncounterMetrics::INVALID();
+  }
+  if (encounter_metrics_ready_.size() != traffic.size()) {
+    encounter_metrics_.assign(traffic.size(),EncounterMetrics());
+    encounter_metrics_ready_.assign(traffic.size(),false);
+  }
+  EncounterMetrics& m = encounter_metrics_[idx];
+  if (!encounter_metrics_ready_[idx]) {
+    const TrafficState& intruder = traffic[idx];
+    const TrafficTable& table = traffic_table();
+    int alerter_idx = alerter_index_of(idx);
+    m = EncounterMetrics(table.s[idx],table.v[idx],alerter_idx,parameters.getLookaheadTime());
+    if (1 <= alerter_idx && alerter_idx <= parameters.numberOfAlerters()) {
+      const Alerter& alerter = parameters.getAlerterAt(alerter_idx);
+      for (int alert_level=1; alert_level <= alerter.mostSevereAlertLevel(); ++alert_level) {
+        const Detection3D& detector = alerter.getDetector(alert_level);
+        ConflictData det = ConflictData::EMPTY();
+        if (detector.isValid()) {
+          // Reuse the detection computed for the conflict region of this alert level, when available
+          int conflict_region = BandsRegion::NUMBER_OF_CONFLICT_BANDS-
+              BandsRegion::orderOfConflictRegion(alerter.getLevel(alert_level).getRegion());
+          if (conflict_region >= BandsRegion::NUMBER_OF_CONFLICT_BANDS ||
+              parameters.alertLevelForConflictRegion(alerter_idx,conflict_region) != alert_level ||
+              !conflict_detection(det,conflict_region,idx)) {
+            det = detector.conflictDetectionWithTrafficState(ownship,intruder,0.0,parameters.getLookaheadTime());
+          }
+        }
+        m.violations.push_back(det);
+      }
+    }
+    encounter_metrics_ready_[idx] = true;
+  }
+  return m;
+}
+
+/**
+ * @return states of traffic aircraft relative to the ownship. The table is built at most once per cycle.
+ * INTERNAL USE ONLY
+ */
+const TrafficTable& DaidalusCore::traffic_table() {
+  if (!traffic_table_ready_) {
+    traffic_table_.build(ownship,traffic);
+    traffic_table_ready_ = true;
+  }
+  return traffic_table_;
+}
+
+int DaidalusCore::dta_hysteresis_current_value(const TrafficState& ac, bool projected) {
   if (parameters.getDTALogic() != 0 && parameters.getDTAAlerter() != 0 &&
       parameters.getDTARadius() > 0 && parameters.getDTAHeight() > 0) {
     std::map<std::string,HysteresisData>::iterator dta_hysteresis_ptr = dta_hysteresis_acs_.find(ac.getId());
@@ -615,8 +940,7 @@ int DaidalusCore::dta_hysteresis_current_value(const TrafficState& ac) {
     if (dta_hysteresis_ptr->second.isUpdatedAtCurrentTime(current_time)) {
       return dta_hysteresis_ptr->second.getLastValue();
     } else {
-      int raw_dta = Util::almost_leq(ac.getPosition().distanceH(parameters.getDTAPosition()),parameters.getDTARadius()) &&
-          Util::almost_leq(ac.getPosition().alt(),parameters.getDTAHeight()) ? 1 : 0;
+      int raw_dta = dta_contains(ac,projected) ? 1 : 0;
       return dta_hysteresis_ptr->second.applyHysteresisLogic(raw_dta,current_time);
     }
   } else {
@@ -624,6 +948,67 @@ int DaidalusCore::dta_hysteresis_current_value(const TrafficState& ac) {
   }
 }
 
+// idx is a 0-based index in the traffic list, -1 is the ownship
+int DaidalusCore::dta_hysteresis_current_value(int idx) {
+  if (dta_acs_.size() != traffic.size()+1) {
+    dta_acs_.assign(traffic.size()+1,-1);
+  }
+  int& dta = dta_acs_[idx+1];
+  if (dta < 0) {
+    dta = dta_hysteresis_current_value(idx < 0 ? ownship : traffic[idx],true);
+  }
+  return dta;
+}
+
+/**
+ * Computes the DTA center in the ownship Euclidean frame. The projected center is only used
+ * with the ENU projection, where horizontal distances between projected points are
+ * bounded by great circle distances (see dta_contains).
+ */
+bool DaidalusCore::refresh_dta_center() {
+  if (dta_center_status_ < 0) {
+    dta_center_status_ = 0;
+    const Position& dta_position = parameters.getDTAPosition();
+    if (ownship.isValid() && ownship.isLatLon() && dta_position.isLatLon() &&
+        Projection::getProjectionType() == ENU) {
+      dta_center_ = ownship.getEuclideanProjection().project(dta_position).vect2();
+      if (dta_center_.norm() < GreatCircle::spherical_earth_radius) {
+        dta_center_status_ = 1;
+      }
+    }
+  }
+  return dta_center_status_ > 0;
+}
+
+/**
+ * Return true if aircraft is within the DTA cylinder. If projected is true, ac is either the ownship or an
+ * aircraft in the traffic list, and the containment check is first attempted in the ownship Euclidean frame.
+ * The ENU projection is orthographic, so if r is the largest projected distance to the ownship of
+ * two points and R is the Earth radius, the projected distance d between them satisfies
+ * d <= great circle distance <= d/sqrt(1-(r/R)^2). The great circle distance is only computed when
+ * these bounds don't decide the containment.
+ */
+bool DaidalusCore::dta_contains(const TrafficState& ac, bool projected) {
+  if (!Util::almost_leq(ac.getPosition().alt(),parameters.getDTAHeight())) {
+    return false;
+  }
+  if (projected && refresh_dta_center()) {
+    Vect2 s = ac.get_s().vect2();
+    double radius = parameters.getDTARadius();
+    double d = s.Sub(dta_center_).norm();
+    double r = Util::max(s.norm(),dta_center_.norm())/GreatCircle::spherical_earth_radius;
+    if (r < 1) {
+      if (d > radius+DTA_PROJECTION_SLACK) {
+        return false;
+      }
+      if (d/std::sqrt(1-r*r) < radius-DTA_PROJECTION_SLACK) {
+        return true;
+      }
+    }
+  }
+  return Util::almost_leq(ac.getPosition().distanceH(parameters.getDTAPosition()),parameters.getDTARadius());
+}
+
 /**
  * Return alert index used for intruder aircraft.
  * The alert index depends on alerting logic and DTA logic.
@@ -634,13 +1019,13 @@ int DaidalusCore::dta_hysteresis_current_value(const TrafficState& ac) {
  */
 int DaidalusCore::alerter_index_of(const TrafficState& intruder) {
   if (parameters.isAlertingLogicOwnshipCentric()) {
-    if (dta_hysteresis_current_value(ownship) == 1) {
+    if (dta_hysteresis_current_value(-1) == 1) {
       return parameters.getDTAAlerter();
     } else {
       return ownship.getAlerterIndex();
     }
   } else {
-    if (dta_hysteresis_current_value(intruder) == 1) {
+    if (dta_hysteresis_current_value(intruder,false) == 1) {
       return parameters.getDTAAlerter();
     } else {
       return intruder.getAlerterIndex();
@@ -648,6 +1033,26 @@ int DaidalusCore::alerter_index_of(const TrafficState& intruder) {
   }
 }
 
+/**
+ * Return alert index used for the idx-th aircraft in the traffic list (0-based index), where
+ * -1 refers to the ownship. The DTA status used to compute this value is cached for the current cycle.
+ */
+int DaidalusCore::alerter_index_of(int idx) {
+  if (parameters.isAlertingLogicOwnshipCentric() || idx < 0) {
+    if (dta_hysteresis_current_value(-1) == 1) {
+      return parameters.getDTAAlerter();
+    } else {
+      return ownship.getAlerterIndex();
+    }
+  } else {
+    if (dta_hysteresis_current_value(idx) == 1) {
+      return parameters.getDTAAlerter();
+    } else {
+      return traffic_table().alerter_index[idx];
+    }
+  }
+}
+
 int DaidalusCore::epsilonH(const TrafficState& ownship, const TrafficState& ac) {
   if (ownship.isValid() && ac.isValid()) {
     Vect2 s = ownship.get_s().Sub(ac.get_s()).vect2();
@@ -735,8 +1140,9 @@ bool DaidalusCore::check_alerting_thresholds(const Alerter& alerter, int alert_l
   return false;
 }
 
-int DaidalusCore::alerting_hysteresis_current_value(const TrafficState& intruder, int turning, int accelerating, int climbing) {
-  int alerter_idx = alerter_index_of(intruder);
+int DaidalusCore::alerting_hysteresis_current_value(int idx, int turning, int accelerating, int climbing) {
+  const TrafficState& intruder = traffic[idx];
+  int alerter_idx = alerter_index_of(idx);
   if (1 <= alerter_idx && alerter_idx <= parameters.numberOfAlerters()) {
     std::map<std::string,HysteresisData>::iterator alerting_hysteresis_ptr = alerting_hysteresis_acs_.find(intruder.getId());
     if (alerting_hysteresis_ptr == alerting_hysteresis_acs_.end()) {
@@ -780,7 +1186,7 @@ int DaidalusCore::alerting_hysteresis_current_value(const TrafficState& intruder
  */
 int DaidalusCore::alert_level(int idx, int turning, int accelerating, int climbing) {
   if (0 <= idx && idx < static_cast<int>(traffic.size())) {
-    return alerting_hysteresis_current_value(traffic[idx],turning,accelerating,climbing);
+    return alerting_hysteresis_current_value(idx,turning,accelerating,climbing);
   } else {
     return -1;
   }
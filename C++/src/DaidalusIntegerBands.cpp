@@ -6,14 +6,144 @@
  */
 
 #include "DaidalusIntegerBands.h"
+#include "MemoryUsage.h"
 #include "CriteriaCore.h"
 #include "TCASTable.h"
 #include "Util.h"
 #include <vector>
 #include <string>
+#include <climits>
 
 namespace larcfm {
 
+thread_local DaidalusIntegerBands::SampleCache* DaidalusIntegerBands::thread_cache_ = NULL;
+
+void DaidalusIntegerBands::SampleCache::clear() {
+  loss_intervals.clear();
+  conflicts.clear();
+  vertical_intervals.clear();
+  horizontal_intervals.clear();
+}
+
+void DaidalusIntegerBands::SampleCache::forget(const Detection3D& det) {
+  // Keys are sorted by detector first
+  SampleKey lb(&det,(const TrafficState*)0,false,NINFINITY,INT_MIN,false);
+  std::map<SampleKey,LossData>::iterator ptr = loss_intervals.lower_bound(lb);
+  while (ptr != loss_intervals.end() && std::get<0>(ptr->first) == &det) {
+    loss_intervals.erase(ptr++);
+  }
+  std::map<ConflictKey,bool>::iterator cptr = conflicts.lower_bound(ConflictKey(lb,NINFINITY,NINFINITY));
+  while (cptr != conflicts.end() && std::get<0>(std::get<0>(cptr->first)) == &det) {
+    conflicts.erase(cptr++);
+  }
+  std::map<VerticalKey,VerticalEntry>::iterator vptr = 
+      vertical_intervals.lower_bound(VerticalKey(&det,(const TrafficState*)0,NINFINITY,NINFINITY));
+  while (vptr != vertical_intervals.end() && std::get<0>(vptr->first) == &det) {
+    vertical_intervals.erase(vptr++);
+  }
+  std::map<HorizontalKey,HorizontalEntry>::iterator hptr = 
+      horizontal_intervals.lower_bound(HorizontalKey(&det,(const TrafficState*)0));
+  while (hptr != horizontal_intervals.end() && hptr->first.first == &det) {
+    horizontal_intervals.erase(hptr++);
+  }
+}
+
+void DaidalusIntegerBands::enable_loss_intervals() {
+  cache_.clear();
+  loss_intervals_enabled_ = true;
+}
+
+void DaidalusIntegerBands::disable_loss_intervals() {
+  cache_.clear();
+  loss_intervals_enabled_ = false;
+}
+
+void DaidalusIntegerBands::forget_loss_intervals(const Detection3D& det) {
+  sample_cache().forget(det);
+}
+
+int DaidalusIntegerBands::loss_intervals_memory_usage() const {
+  return MemoryUsage::map_bytes(cache_.loss_intervals)+MemoryUsage::map_bytes(cache_.conflicts)+
+      MemoryUsage::map_bytes(cache_.vertical_intervals)+MemoryUsage::map_bytes(cache_.horizontal_intervals);
+}
+
+const Interval& DaidalusIntegerBands::vertical_interval(const Detection3D& det, const TrafficState& traffic, 
+    double sz, double voz, double viz, double B, double T) const {
+  std::map<VerticalKey,VerticalEntry>& vertical_intervals = sample_cache().vertical_intervals;
+  VerticalKey key(&det,&traffic,B,T);
+  std::map<VerticalKey,VerticalEntry>::iterator ptr = vertical_intervals.find(key);
+  if (ptr == vertical_intervals.end()) {
+    ptr = vertical_intervals.insert(std::make_pair(key,VerticalEntry(sz,voz,viz,det.verticalInterval(sz,voz,viz,B,T)))).first;
+  } else if (ptr->second.sz != sz || ptr->second.voz != voz || ptr->second.viz != viz) {
+    ptr->second = VerticalEntry(sz,voz,viz,det.verticalInterval(sz,voz,viz,B,T));
+  }
+  return ptr->second.ii;
+}
+
+LossData DaidalusIntegerBands::separable_detection(const Detection3D& det, const TrafficState& own, const TrafficState& traffic,
+    double B, double T) const {
+  const Vect3& so = own.get_s();
+  const Vect3& vo = own.get_v();
+  const Vect3& si = traffic.get_s();
+  const Vect3& vi = traffic.get_v();
+  const Interval& ii = vertical_interval(det,traffic,so.z()-si.z(),vo.z(),vi.z(),B,T);
+  return det.horizontalIntervalWithin(ii,so.vect2().Sub(si.vect2()),vo.vect2(),vi.vect2(),B,T);
+}
+
+LossData DaidalusIntegerBands::separable_loss_interval(const Detection3D& det, const TrafficState& own, const TrafficState& traffic) const {
+  const Vect3& so = own.get_s();
+  const Vect3& vo = own.get_v();
+  const Vect3& si = traffic.get_s();
+  const Vect3& vi = traffic.get_v();
+  Vect2 s2 = so.vect2().Sub(si.vect2());
+  const Vect2& vo2 = vo.vect2();
+  const Vect2& vi2 = vi.vect2();
+  std::map<HorizontalKey,HorizontalEntry>& horizontal_intervals = sample_cache().horizontal_intervals;
+  HorizontalKey key(&det,&traffic);
+  std::map<HorizontalKey,HorizontalEntry>::iterator ptr = horizontal_intervals.find(key);
+  if (ptr == horizontal_intervals.end()) {
+    ptr = horizontal_intervals.insert(std::make_pair(key,HorizontalEntry(s2,vo2,vi2,det.horizontalInterval(s2,vo2,vi2)))).first;
+  } else if (ptr->second.s.x != s2.x || ptr->second.s.y != s2.y || ptr->second.vo.x != vo2.x || ptr->second.vo.y != vo2.y ||
+      ptr->second.vi.x != vi2.x || ptr->second.vi.y != vi2.y) {
+    ptr->second = HorizontalEntry(s2,vo2,vi2,det.horizontalInterval(s2,vo2,vi2));
+  }
+  return Detection3D::separableLossInterval(ptr->second.ii,vertical_interval(det,traffic,so.z()-si.z(),vo.z(),vi.z(),0.0,0.0));
+}
+
+bool DaidalusIntegerBands::conflict_at_sample(const Detection3D& det, const TrafficState& own, const TrafficState& traffic,
+    double B, double T, bool trajdir, double tsk, int target_step, bool instantaneous) const {
+  if (!loss_intervals_enabled_) {
+    return det.conflictWithTrafficState(own,traffic,B,T);
+  }
+  SampleCache& cache = sample_cache();
+  SampleKey key(&det,&traffic,trajdir,tsk,target_step,instantaneous);
+  if (det.hasLossInterval()) {
+    std::map<SampleKey,LossData>::const_iterator ptr = cache.loss_intervals.find(key);
+    if (ptr == cache.loss_intervals.end()) {
+      LossData interval = det.hasVerticalInterval() ? separable_loss_interval(det,own,traffic) : 
+          det.lossIntervalWithTrafficState(own,traffic);
+      ptr = cache.loss_intervals.insert(std::make_pair(key,interval)).first;
+    }
+    return ptr->second.conflictBetween(B,T);
+  }
+  ConflictKey ckey(key,B,T);
+  std::map<ConflictKey,bool>::const_iterator ptr = cache.conflicts.find(ckey);
+  if (ptr == cache.conflicts.end()) {
+    bool conflict;
+    if (!det.hasVerticalInterval()) {
+      conflict = det.conflictWithTrafficState(own,traffic,B,T);
+    } else if (Util::almost_equals(B,T)) {
+      // Same as Detection3D::conflictWithTrafficState
+      LossData interval = separable_detection(det,own,traffic,B,B+1);
+      conflict = interval.conflict() && Util::almost_equals(interval.getTimeIn(),B);
+    } else {
+      conflict = B < T && separable_detection(det,own,traffic,B,T).conflict();
+    }
+    ptr = cache.conflicts.insert(std::make_pair(ckey,conflict)).first;
+  }
+  return ptr->second;
+}
+
 /**
  * In PVS: int_bands@CD_future_traj
  */
@@ -28,7 +158,7 @@ bool DaidalusIntegerBands::CD_future_traj(const Detection3D& det, double B, doub
   TrafficState own = ownship;
   own.setPosition(Position::make(sat));
   own.setAirVelocity(Velocity::make(vot));
-  return det.conflictWithTrafficState(own,traffic,Util::max(B,tsk),T);
+  return conflict_at_sample(det,own,traffic,Util::max(B,tsk),T,trajdir,tsk,target_step,instantaneous);
 }
 
 /**
@@ -60,7 +190,7 @@ bool DaidalusIntegerBands::LOS_at(const Detection3D& det, bool trajdir, double t
   TrafficState own = ownship;
   own.setPosition(Position::make(sat));
   own.setAirVelocity(Velocity::make(vot));
-  return det.violationAtWithTrafficState(own,traffic,tsk);
+  return conflict_at_sample(det,own,traffic,tsk,tsk,trajdir,tsk,target_step,instantaneous);
 }
 
 bool DaidalusIntegerBands::LOS_at_coast(const Detection3D& det, bool trajdir, double tsk, double tcoast,
@@ -76,7 +206,7 @@ bool DaidalusIntegerBands::LOS_at_coast(const Detection3D& det, bool trajdir, do
 	TrafficState own = ownship;
 	own.setPosition(Position::make(sat));
 	own.setAirVelocity(Velocity::make(vot));
-	return det.conflictWithTrafficState(own,traffic,tsk,tsk+tcoast); 
+	return conflict_at_sample(det,own,traffic,tsk,tsk+tcoast,trajdir,tsk,target_step,instantaneous);
 }
 
 // In PVS: int_bands@first_los_step
@@ -6,6 +6,7 @@
  */
 
 #include "DaidalusParameters.h"
+#include "MemoryUsage.h"
 #include "ParameterData.h"
 #include "StateReader.h"
 #include "Units.h"
@@ -212,6 +213,8 @@ DaidalusParameters::DaidalusParameters() : error("DaidalusParameters") {
 
   corrective_region_ = BandsRegion::NEAR;
 
+  compile_alerting_plan();
+
   init();
 }
 
@@ -264,6 +267,7 @@ int DaidalusParameters::getAlerterIndex(const std::string& id) const {
 
 void DaidalusParameters::clearAlerters() {
   alerters_.clear();
+  compile_alerting_plan();
 }
 
 /**
@@ -279,9 +283,52 @@ int DaidalusParameters::addAlerter(const Alerter& alerter) {
     alerters_[i-1] = alerter;
   }
   set_alerter_with_SUM_parameters(alerters_[i-1]);
+  compile_alerting_plan();
   return i;
 }
 
+void DaidalusParameters::compile_alerting_plan() {
+  alerting_plan_.clear();
+  for (int conflict_region=0; conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++conflict_region) {
+    alerting_plan_regions_[conflict_region] = false;
+  }
+  for (int i=0; i < static_cast<int>(alerters_.size()); ++i) {
+    for (int conflict_region=0; conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++conflict_region) {
+      BandsRegion::Region region = BandsRegion::regionFromOrder(BandsRegion::NUMBER_OF_CONFLICT_BANDS-conflict_region);
+      int level = alerters_[i].alertLevelForRegion(region);
+      if (level > 0) {
+        const AlertThresholds& athr = alerters_[i].getLevel(level);
+        alerting_plan_.push_back(AlertingPlanEntry(level,athr.getAlertingTime(),athr.getEarlyAlertingTime()));
+        alerting_plan_regions_[conflict_region] = true;
+      } else {
+        alerting_plan_.push_back(AlertingPlanEntry(-1,NaN,NaN));
+      }
+    }
+  }
+}
+
+int DaidalusParameters::alertLevelForConflictRegion(int alerter_idx, int conflict_region) const {
+  if (1 <= alerter_idx && alerter_idx <= static_cast<int>(alerters_.size()) &&
+      0 <= conflict_region && conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS) {
+    return alerting_plan_[(alerter_idx-1)*BandsRegion::NUMBER_OF_CONFLICT_BANDS+conflict_region].level;
+  }
+  return -1;
+}
+
+double DaidalusParameters::alertingTimeForConflictRegion(int alerter_idx, int conflict_region, bool early) const {
+  if (1 <= alerter_idx && alerter_idx <= static_cast<int>(alerters_.size()) &&
+      0 <= conflict_region && conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS) {
+    const AlertingPlanEntry& entry = alerting_plan_[(alerter_idx-1)*BandsRegion::NUMBER_OF_CONFLICT_BANDS+conflict_region];
+    return early ? entry.early_alerting_time : entry.alerting_time;
+  }
+  return NaN;
+}
+
+bool DaidalusParameters::hasAlertLevelForConflictRegion(int conflict_region) const {
+  return 0 <= conflict_region && conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS &&
+      alerting_plan_regions_[conflict_region];
+}
+
 /** This method is needed because WCV_TAUMOD_SUM doesn't require the
  *  user to initialize SUM parameters, which may be specified globally.
  */
@@ -1924,8 +1971,9 @@ bool DaidalusParameters::setCorrectiveRegion(BandsRegion::Region val) {
  */
 int DaidalusParameters::correctiveAlertLevel(int alerter_idx) {
   if (1 <= alerter_idx && alerter_idx <= static_cast<int>(alerters_.size())) {
-    Alerter alerter = alerters_[alerter_idx-1];
-    return alerter.alertLevelForRegion(corrective_region_);
+    // Corrective region is always a conflict region
+    return alertLevelForConflictRegion(alerter_idx,
+        BandsRegion::NUMBER_OF_CONFLICT_BANDS-BandsRegion::orderOfRegion(corrective_region_));
   } else {
     error.addError("correctiveAlertLevel: alerter_idx ("+Fmi(alerter_idx)+") is out of range");
     return -1;
@@ -2002,6 +2050,96 @@ bool DaidalusParameters::saveToFile(const std::string& file) {
   return true;
 }
 
+static const char COMPILED_MAGIC[4] = {'D','A','C','P'};
+static const unsigned int COMPILED_VERSION = 1;
+
+// FNV-1a hash of the contents of a file. Return false if file cannot be read.
+static bool compiled_source_hash(const std::string& file, unsigned long long& hash) {
+  std::ifstream in(file.c_str(),std::ios::binary);
+  if (in.fail()) {
+    return false;
+  }
+  hash = 14695981039346656037ULL;
+  char buf[4096];
+  while (in.read(buf,sizeof(buf)) || in.gcount() > 0) {
+    std::streamsize n = in.gcount();
+    for (std::streamsize i = 0; i < n; ++i) {
+      hash ^= static_cast<unsigned char>(buf[i]);
+      hash *= 1099511628211ULL;
+    }
+  }
+  return true;
+}
+
+bool DaidalusParameters::saveCompiled(const std::string& file, const std::string& source) {
+  unsigned long long hash = 0;
+  if (source != "" && !compiled_source_hash(source,hash)) {
+    error.addError("saveCompiled: File "+source+" not found");
+    return false;
+  }
+  std::ofstream out(file.c_str(),std::ios::binary);
+  if ( out.fail() ) {
+    error.addError("saveCompiled: File "+file+" is protected");
+    return false;
+  }
+  ParameterData p;
+  updateParameterData(p);
+  unsigned int version = COMPILED_VERSION;
+  unsigned int n = static_cast<unsigned int>(VERSION.size());
+  out.write(COMPILED_MAGIC,sizeof(COMPILED_MAGIC));
+  out.write(reinterpret_cast<const char*>(&version),sizeof(version));
+  out.write(reinterpret_cast<const char*>(&n),sizeof(n));
+  out.write(VERSION.data(),n);
+  out.write(reinterpret_cast<const char*>(&hash),sizeof(hash));
+  if (!p.writeBinary(out)) {
+    error.addError("saveCompiled: Error writing file "+file);
+    return false;
+  }
+  return true;
+}
+
+bool DaidalusParameters::loadCompiled(const std::string& file, const std::string& source) {
+  std::ifstream in(file.c_str(),std::ios::binary);
+  if (in.fail()) {
+    error.addError("loadCompiled: File "+file+" not found");
+    return false;
+  }
+  char magic[sizeof(COMPILED_MAGIC)];
+  unsigned int version = 0;
+  unsigned int n = 0;
+  unsigned long long hash = 0;
+  if (!in.read(magic,sizeof(magic)) || !std::equal(magic,magic+sizeof(magic),COMPILED_MAGIC) ||
+      !in.read(reinterpret_cast<char*>(&version),sizeof(version)) || version != COMPILED_VERSION ||
+      !in.read(reinterpret_cast<char*>(&n),sizeof(n)) || n != VERSION.size()) {
+    error.addError("loadCompiled: File "+file+" is not a compiled configuration of version "+VERSION);
+    return false;
+  }
+  std::string daidalus_version(n,' ');
+  if (!in.read(&daidalus_version[0],n) || daidalus_version != VERSION ||
+      !in.read(reinterpret_cast<char*>(&hash),sizeof(hash))) {
+    error.addError("loadCompiled: File "+file+" is not a compiled configuration of version "+VERSION);
+    return false;
+  }
+  if (source != "") {
+    unsigned long long source_hash = 0;
+    if (!compiled_source_hash(source,source_hash)) {
+      error.addError("loadCompiled: File "+source+" not found");
+      return false;
+    }
+    if (source_hash != hash) {
+      error.addError("loadCompiled: File "+file+" is stale with respect to "+source);
+      return false;
+    }
+  }
+  ParameterData p;
+  if (!p.readBinary(in)) {
+    error.addError("loadCompiled: Error reading file "+file);
+    return false;
+  }
+  setParameters(p);
+  return true;
+}
+
 /**
  * The following method set default output precision and enable/disable trailing zeros.
  * It doesn't affect computations.
@@ -2312,6 +2450,7 @@ void DaidalusParameters::readAlerterList(const std::vector<std::string>& alerter
     }
     alerters_.push_back(alerter);
   }
+  compile_alerting_plan();
 }
 
 bool DaidalusParameters::setParameterData(const ParameterData& p) {
@@ -2638,6 +2777,7 @@ bool DaidalusParameters::setParameterData(const ParameterData& p) {
     if (alerter.isValid()) {
       alerters_.clear();
       alerters_.push_back(alerter);
+      compile_alerting_plan();
       int conflict_level=getInt(p,"conflict_level");
       if (1 <= conflict_level && conflict_level <= alerter.mostSevereAlertLevel()) {
         setCorrectiveRegion(alerter.getLevel(conflict_level).getRegion());
@@ -2691,4 +2831,14 @@ std::string DaidalusParameters::getMessageNoClear()  const {
   return error.getMessageNoClear();
 }
 
+int DaidalusParameters::memoryUsage() const {
+  int bytes = MemoryUsage::vector_bytes(alerters_)+MemoryUsage::vector_bytes(alerting_plan_)+
+      MemoryUsage::units_bytes(units_);
+  std::vector<Alerter>::const_iterator ptr;
+  for (ptr = alerters_.begin(); ptr != alerters_.end(); ++ptr) {
+    bytes += ptr->memoryUsage();
+  }
+  return bytes;
+}
+
 }
@@ -24,6 +24,9 @@
 #include <cmath>
 #include <vector>
 #include <string>
+#include <sstream>
+#include <functional>
+#include <algorithm>
 
 #include "ColorValue.h"
 #include "TrafficState.h"
@@ -230,9 +233,51 @@ void DaidalusRealBands::clear_hysteresis() {
   stale();
 }
 
+/**
+ * Write hysteresis information into buf
+ */
+void DaidalusRealBands::write_state(StateBuffer& buf) const {
+  bands_hysteresis_.writeState(buf);
+}
+
+/**
+ * Read from buf information written by write_state. Return false, without modifying
+ * this object, if buf has an error.
+ */
+bool DaidalusRealBands::read_state(StateBuffer& buf) {
+  BandsHysteresis bands_hysteresis;
+  if (!bands_hysteresis.readState(buf)) {
+    return false;
+  }
+  bands_hysteresis_ = bands_hysteresis;
+  stale();
+  return true;
+}
+
 /**
  * Returns true is object is fresh
  */
+void DaidalusRealBands::memory_usage(MemoryUsage& usage) const {
+  usage.bands_hysteresis += bands_hysteresis_.memoryUsage();
+  usage.bands_caches += MemoryUsage::vector_bytes(ranges_)+MemoryUsage::vector_bytes(acs_peripheral_bands_)+
+      MemoryUsage::vector_bytes(acs_bands_)+loss_intervals_memory_usage();
+  for (int conflict_region=0; conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++conflict_region) {
+    usage.bands_caches += MemoryUsage::vector_bytes(acs_peripheral_bands_[conflict_region])+
+        MemoryUsage::vector_bytes(acs_bands_[conflict_region]);
+  }
+}
+
+void DaidalusRealBands::trim_memory(double current_time) {
+  if (outdated_) {
+    std::vector<BandsRange>().swap(ranges_);
+    for (int conflict_region=0; conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++conflict_region) {
+      std::vector<IndexLevelT>().swap(acs_peripheral_bands_[conflict_region]);
+      std::vector<IndexLevelT>().swap(acs_bands_[conflict_region]);
+    }
+  }
+  bands_hysteresis_.trimIfExpired(current_time);
+}
+
 bool DaidalusRealBands::isFresh() const {
   return !outdated_;
 }
@@ -243,6 +288,9 @@ bool DaidalusRealBands::isFresh() const {
 void DaidalusRealBands::refresh(DaidalusCore& core) {
   if (outdated_) {
     if (set_input(core.parameters,core.ownship,core.getSpecialBandFlags())) {
+      // Ownship and traffic are fixed during the refresh. Hence, loss intervals per trajectory sample
+      // are shared by all band predicates.
+      enable_loss_intervals();
       for (int conflict_region=0; conflict_region < BandsRegion::NUMBER_OF_CONFLICT_BANDS; ++conflict_region) {
         acs_bands_[conflict_region] = core.acs_conflict_bands(conflict_region);
         if (core.bands_for(conflict_region)) {
@@ -251,6 +299,7 @@ void DaidalusRealBands::refresh(DaidalusCore& core) {
         }
       }
       compute(core);
+      disable_loss_intervals();
     }
     outdated_ = false;
   }
@@ -272,22 +321,22 @@ void DaidalusRealBands::peripheral_aircraft(DaidalusCore& core, int conflict_reg
   // Iterate on all traffic aircraft
   for (int ac = 0; ac < static_cast<int>(core.traffic.size()); ++ac) {
     const TrafficState& intruder = core.traffic[ac];
-    int alerter_idx = core.alerter_index_of(intruder);
-    if (1 <= alerter_idx && alerter_idx <= core.parameters.numberOfAlerters()) {
-      const Alerter& alerter = core.parameters.getAlerterAt(alerter_idx);
-      // Assumes that thresholds of severe alerts are included in the volume of less severe alerts
-      BandsRegion::Region region = BandsRegion::regionFromOrder(BandsRegion::NUMBER_OF_CONFLICT_BANDS-conflict_region);
-      int alert_level = alerter.alertLevelForRegion(region);
-      if (alert_level > 0) {
-        const Detection3D& detector = alerter.getLevel(alert_level).getCoreDetection();
-        double alerting_time = Util::min(core.parameters.getLookaheadTime(),
-            alerter.getLevel(alert_level).getAlertingTime());
-        ConflictData det = detector.conflictDetectionWithTrafficState(core.ownship,intruder,0.0,core.parameters.getLookaheadTime());
-        if (!det.conflictBefore(alerting_time) && kinematic_conflict(core.parameters,core.ownship,intruder,detector,
-            core.epsilonH(false,intruder),core.epsilonV(false,intruder),alerting_time,
-            core.getSpecialBandFlags())) {
-          acs_peripheral_bands_[conflict_region].push_back(IndexLevelT(ac,alert_level,alerting_time));
-        }
+    int alerter_idx = core.alerter_index_of(ac);
+    // Assumes that thresholds of severe alerts are included in the volume of less severe alerts
+    int alert_level = core.parameters.alertLevelForConflictRegion(alerter_idx,conflict_region);
+    if (alert_level > 0) {
+      const Detection3D& detector = core.parameters.getAlerterAt(alerter_idx).getLevel(alert_level).getCoreDetection();
+      double alerting_time = Util::min(core.parameters.getLookaheadTime(),
+          core.parameters.alertingTimeForConflictRegion(alerter_idx,conflict_region,false));
+      ConflictData det;
+      // Reuse the detection computed by the core for this region, when available
+      if (!core.conflict_detection(det,conflict_region,ac)) {
+        det = detector.conflictDetectionWithTrafficState(core.ownship,intruder,0.0,core.parameters.getLookaheadTime());
+      }
+      if (!det.conflictBefore(alerting_time) && kinematic_conflict(core.parameters,core.ownship,intruder,detector,
+          core.epsilonH(false,intruder),core.epsilonV(false,intruder),alerting_time,
+          core.getSpecialBandFlags())) {
+        acs_peripheral_bands_[conflict_region].push_back(IndexLevelT(ac,alert_level,alerting_time));
       }
     }
   }
@@ -379,7 +428,7 @@ void DaidalusRealBands::compute_none_bands(IntervalSet& none_set_region, const s
   std::vector<IndexLevelT>::const_iterator ilt_ptr;
   for (ilt_ptr = ilts.begin(); ilt_ptr != ilts.end(); ++ilt_ptr) {
     const TrafficState& intruder = core.traffic[ilt_ptr->index];
-    int alerter_idx = core.alerter_index_of(intruder);
+    int alerter_idx = core.alerter_index_of(ilt_ptr->index);
     if (1 <= alerter_idx && alerter_idx <= core.parameters.numberOfAlerters()) {
       const Alerter& alerter = core.parameters.getAlerterAt(alerter_idx);
       const Detection3D& detector = (!det.isValid() ? alerter.getLevel(ilt_ptr->level).getCoreDetection() : det);
@@ -420,8 +469,9 @@ bool DaidalusRealBands::compute_recovery_bands(IntervalSet& none_set_region, con
   recovery_nfactor_ = 0;
   recovery_horizontal_distance_ = NINFINITY;
   recovery_vertical_distance_ = NINFINITY;
-  double T = core.parameters.getLookaheadTime();
   CDCylinder cd3d = CDCylinder::mk(core.parameters.getHorizontalNMAC(),core.parameters.getVerticalNMAC());
+  // Cached loss intervals are keyed by detector, so they are forgotten every time the cylinder changes
+  forget_loss_intervals(cd3d);
   compute_none_bands(none_set_region,ilts,cd3d,NoDetector::A_NoDetector(),true,0.0,core);
   if (none_set_region.isEmpty()) {
     // If solid red, nothing to do. No way to kinematically escape using vertical speed without intersecting the
@@ -429,57 +479,120 @@ bool DaidalusRealBands::compute_recovery_bands(IntervalSet& none_set_region, con
     return false;
   } else {
     cd3d = CDCylinder::mk(core.minHorizontalRecovery(),core.minVerticalRecovery());
+    forget_loss_intervals(cd3d);
     double factor = 1-core.parameters.getCollisionAvoidanceBandsFactor();
+    if (core.recovery_threads > 1 && core.parameters.isEnabledCollisionAvoidanceBands() && factor < 1) {
+      return compute_recovery_bands_concurrently(none_set_region,ilts,cd3d,core);
+    }
     while (cd3d.getHorizontalSeparation()  > core.parameters.getHorizontalNMAC() ||
         cd3d.getVerticalSeparation() > core.parameters.getVerticalNMAC()) {
-      compute_none_bands(none_set_region,ilts,cd3d,NoDetector::A_NoDetector(),true,0.0,core);
-      bool solidred = none_set_region.isEmpty();
-      if (solidred && !core.parameters.isEnabledCollisionAvoidanceBands()) {
+      double recovery_time;
+      if (recovery_bands_for(none_set_region,ilts,cd3d,recovery_time,core)) {
+        recovery_time_ = recovery_time;
+        recovery_horizontal_distance_ = cd3d.getHorizontalSeparation();
+        recovery_vertical_distance_ = cd3d.getVerticalSeparation();
+        return true;
+      } else if (!core.parameters.isEnabledCollisionAvoidanceBands()) {
         // Saturated band and collision avoidance is not enabled. Nothing to do here.
         return false;
-      } else if (!solidred) {
-        // Find first green band
-        double pivot_red = 0;
-        double pivot_green = T+1;
-        double pivot = pivot_green-1;
-        while ((pivot_green-pivot_red) > 0.5) {
-          compute_none_bands(none_set_region,ilts,NoDetector::A_NoDetector(),cd3d,true,pivot,core);
-          solidred = none_set_region.isEmpty();
-          if (solidred) {
-            pivot_red = pivot;
-          } else {
-            pivot_green = pivot;
-          }
-          pivot = (pivot_red+pivot_green)/2.0;
-        }
-        double recovery_time;
-        if (pivot_green <= T) {
-          recovery_time = Util::min(T,
-              pivot_green+core.parameters.getRecoveryStabilityTime());
-        } else {
-          recovery_time = pivot_red;
-        }
-        compute_none_bands(none_set_region,ilts,NoDetector::A_NoDetector(),cd3d,true,
-            recovery_time,core);
-        solidred = none_set_region.isEmpty();
-        if (!solidred) {
-          recovery_time_ = recovery_time;
-          recovery_horizontal_distance_ = cd3d.getHorizontalSeparation();
-          recovery_vertical_distance_ = cd3d.getVerticalSeparation();
-          return true;
-        } else if (!core.parameters.isEnabledCollisionAvoidanceBands()) {
-          // Nothing else to do. Collision avoidance bands are not enabled.
-          return false;
-        }
       }
       ++recovery_nfactor_;
       cd3d.setHorizontalSeparation(std::max(core.parameters.getHorizontalNMAC(),cd3d.getHorizontalSeparation()*factor));
       cd3d.setVerticalSeparation(std::max(core.parameters.getVerticalNMAC(),cd3d.getVerticalSeparation()*factor));
+      forget_loss_intervals(cd3d);
     }
   }
   return false;
 }
 
+/**
+ * Compute recovery bands in none_set_region for the recovery cylinder cd3d. Return true if
+ * recovery bands are not saturated. In this case, recovery_time is set.
+ */
+bool DaidalusRealBands::recovery_bands_for(IntervalSet& none_set_region, const std::vector<IndexLevelT>& ilts,
+    const CDCylinder& cd3d, double& recovery_time, DaidalusCore& core) {
+  compute_none_bands(none_set_region,ilts,cd3d,NoDetector::A_NoDetector(),true,0.0,core);
+  if (none_set_region.isEmpty()) {
+    return false;
+  }
+  double T = core.parameters.getLookaheadTime();
+  // Find first green band
+  double pivot_red = 0;
+  double pivot_green = T+1;
+  double pivot = pivot_green-1;
+  while ((pivot_green-pivot_red) > 0.5) {
+    compute_none_bands(none_set_region,ilts,NoDetector::A_NoDetector(),cd3d,true,pivot,core);
+    if (none_set_region.isEmpty()) {
+      pivot_red = pivot;
+    } else {
+      pivot_green = pivot;
+    }
+    pivot = (pivot_red+pivot_green)/2.0;
+  }
+  if (pivot_green <= T) {
+    recovery_time = Util::min(T,
+        pivot_green+core.parameters.getRecoveryStabilityTime());
+  } else {
+    recovery_time = pivot_red;
+  }
+  compute_none_bands(none_set_region,ilts,NoDetector::A_NoDetector(),cd3d,true,
+      recovery_time,core);
+  return !none_set_region.isEmpty();
+}
+
+void DaidalusRealBands::recovery_bands_task(int k, std::vector<IntervalSet>& none_sets, const std::vector<IndexLevelT>& ilts,
+    const std::vector<CDCylinder>& cylinders, std::vector<double>& recovery_times, std::vector<int>& found, DaidalusCore& core) {
+  PrivateCacheScope scope;
+  found[k] = recovery_bands_for(none_sets[k],ilts,cylinders[k],recovery_times[k],core) ? 1 : 0;
+}
+
+/**
+ * Same as the loop of compute_recovery_bands that reduces the recovery cylinder cd3d, but
+ * several cylinder sizes, up to core.recovery_threads, are evaluated concurrently by the executor
+ * of core. Sizes are evaluated in batches, from the largest to the smallest one, and the largest 
+ * size with non-saturated recovery bands is selected, as in the serial loop. 
+ * Requires collision avoidance bands to be enabled. Furthermore, the values of core that are lazily 
+ * computed by compute_none_bands have already been computed by the NMAC pass of compute_recovery_bands, 
+ * so that the tasks only read core.
+ */
+bool DaidalusRealBands::compute_recovery_bands_concurrently(IntervalSet& none_set_region, const std::vector<IndexLevelT>& ilts,
+    const CDCylinder& cd3d, DaidalusCore& core) {
+  double factor = 1-core.parameters.getCollisionAvoidanceBandsFactor();
+  std::vector<CDCylinder> cylinders;
+  CDCylinder cyl = cd3d;
+  while (cyl.getHorizontalSeparation()  > core.parameters.getHorizontalNMAC() ||
+      cyl.getVerticalSeparation() > core.parameters.getVerticalNMAC()) {
+    cylinders.push_back(cyl);
+    cyl.setHorizontalSeparation(std::max(core.parameters.getHorizontalNMAC(),cyl.getHorizontalSeparation()*factor));
+    cyl.setVerticalSeparation(std::max(core.parameters.getVerticalNMAC(),cyl.getVerticalSeparation()*factor));
+  }
+  int n = (int)cylinders.size();
+  std::vector<IntervalSet> none_sets(n);
+  std::vector<double> recovery_times(n,NINFINITY);
+  std::vector<int> found(n,0);
+  for (int first = 0; first < n; first += core.recovery_threads) {
+    int last = std::min(n,first+core.recovery_threads);
+    core.getExecutor().parallel_for(first,last,std::bind(&DaidalusRealBands::recovery_bands_task,this,std::placeholders::_1,
+        std::ref(none_sets),std::cref(ilts),std::cref(cylinders),std::ref(recovery_times),std::ref(found),std::ref(core)));
+    for (int k = first; k < last; ++k) {
+      if (found[k]) {
+        none_set_region = none_sets[k];
+        recovery_nfactor_ = k;
+        recovery_time_ = recovery_times[k];
+        recovery_horizontal_distance_ = cylinders[k].getHorizontalSeparation();
+        recovery_vertical_distance_ = cylinders[k].getVerticalSeparation();
+        return true;
+      }
+    }
+  }
+  recovery_nfactor_ = n;
+  if (n > 0) {
+    // As in the serial loop, the bands of the last cylinder are saturated
+    none_set_region.clear();
+  }
+  return false;
+}
+
 /**
  * Requires: compute_bands(conflict_region) = true && 0 <= conflict_region < CONFLICT_BANDS
  * Compute bands for one region. Return true iff recovery bands were computed.
@@ -804,33 +917,42 @@ std::string DaidalusRealBands::rawString() const {
 }
 
 std::string DaidalusRealBands::toString() const {
-  std::string s("");
+  std::ostringstream out;
+  toString(out);
+  return out.str();
+}
+
+void DaidalusRealBands::toString(std::ostream& out) const {
   for (int i = 0; i < static_cast<int>(ranges_.size()); ++i) {
-    s+="ranges["+Fmi(i)+"] = ";
-    s+=ranges_[i].toString()+"\n";
+    out << "ranges[" << Fmi(i) << "] = ";
+    out << ranges_[i].toString() << "\n";
   }
-  s+="recovery_time = "+FmPrecision(recovery_time_)+" [s]\n";
-  s+="recovery_nfactor = "+Fmi(recovery_nfactor_)+"\n";
-  s+="recovery_horizontal_distance = "+FmPrecision(recovery_horizontal_distance_)+ " [m]\n";
-  s+="recovery_vertical_distance = "+FmPrecision(recovery_vertical_distance_)+ " [m]\n";
-  s+="preferred_dir = "+Fmb(bands_hysteresis_.getLastPreferredDirection())+"\n";
-  s+="resolution_low = "+FmPrecision(bands_hysteresis_.getLastResolutionLow())+"\n";
-  s+="resolution_up = "+FmPrecision(bands_hysteresis_.getLastResolutionUp())+"\n";
-  return s;
+  out << "recovery_time = " << FmPrecision(recovery_time_) << " [s]\n";
+  out << "recovery_nfactor = " << Fmi(recovery_nfactor_) << "\n";
+  out << "recovery_horizontal_distance = " << FmPrecision(recovery_horizontal_distance_) << " [m]\n";
+  out << "recovery_vertical_distance = " << FmPrecision(recovery_vertical_distance_) << " [m]\n";
+  out << "preferred_dir = " << Fmb(bands_hysteresis_.getLastPreferredDirection()) << "\n";
+  out << "resolution_low = " << FmPrecision(bands_hysteresis_.getLastResolutionLow()) << "\n";
+  out << "resolution_up = " << FmPrecision(bands_hysteresis_.getLastResolutionUp()) << "\n";
 }
 
 std::string DaidalusRealBands::toPVS() const {
-  std::string s = "(:";
+  std::ostringstream out;
+  toPVS(out);
+  return out.str();
+}
+
+void DaidalusRealBands::toPVS(std::ostream& out) const {
+  out << "(:";
   for (int i = 0; i < static_cast<int>(ranges_.size()); ++i) {
     if (i > 0) {
-      s+=", ";
+      out << ", ";
     } else {
-      s+=" ";
+      out << " ";
     }
-    s += ranges_[i].toPVS();
+    out << ranges_[i].toPVS();
   }
-  s+=" :)";
-  return s;
+  out << " :)";
 }
 
 }
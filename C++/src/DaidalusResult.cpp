@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "DaidalusResult.h"
+#include "Daidalus.h"
+#include "format.h"
+
+namespace larcfm {
+
+DaidalusResult::DaidalusResult(Daidalus& daa) :
+    current_time_(daa.getCurrentTime()),
+    ownship_(daa.getOwnshipState()) {
+  for (int ac=1; ac <= daa.lastTrafficIndex(); ++ac) {
+    traffic_.push_back(daa.getAircraftStateAt(ac));
+    alert_levels_.push_back(daa.alertLevel(ac));
+  }
+  for (int i=0; i < daa.horizontalDirectionBandsLength(); ++i) {
+    ranges_[DIRECTION].push_back(BandsRange(daa.horizontalDirectionIntervalAt(i),daa.horizontalDirectionRegionAt(i)));
+  }
+  for (int i=0; i < daa.horizontalSpeedBandsLength(); ++i) {
+    ranges_[HORIZONTAL_SPEED].push_back(BandsRange(daa.horizontalSpeedIntervalAt(i),daa.horizontalSpeedRegionAt(i)));
+  }
+  for (int i=0; i < daa.verticalSpeedBandsLength(); ++i) {
+    ranges_[VERTICAL_SPEED].push_back(BandsRange(daa.verticalSpeedIntervalAt(i),daa.verticalSpeedRegionAt(i)));
+  }
+  for (int i=0; i < daa.altitudeBandsLength(); ++i) {
+    ranges_[ALTITUDE].push_back(BandsRange(daa.altitudeIntervalAt(i),daa.altitudeRegionAt(i)));
+  }
+  for (int d=0; d < 2; ++d) {
+    bool dir = d > 0;
+    resolution_[DIRECTION][d] = daa.horizontalDirectionResolution(dir);
+    resolution_[HORIZONTAL_SPEED][d] = daa.horizontalSpeedResolution(dir);
+    resolution_[VERTICAL_SPEED][d] = daa.verticalSpeedResolution(dir);
+    resolution_[ALTITUDE][d] = daa.altitudeResolution(dir);
+  }
+  preferred_[DIRECTION] = daa.preferredHorizontalDirectionRightOrLeft();
+  preferred_[HORIZONTAL_SPEED] = daa.preferredHorizontalSpeedUpOrDown();
+  preferred_[VERTICAL_SPEED] = daa.preferredVerticalSpeedUpOrDown();
+  preferred_[ALTITUDE] = daa.preferredAltitudeUpOrDown();
+  recovery_.push_back(daa.horizontalDirectionRecoveryInformation());
+  recovery_.push_back(daa.horizontalSpeedRecoveryInformation());
+  recovery_.push_back(daa.verticalSpeedRecoveryInformation());
+  recovery_.push_back(daa.altitudeRecoveryInformation());
+}
+
+int DaidalusResult::bandsLength(int dim) const {
+  return ranges_[dim].size();
+}
+
+Interval DaidalusResult::intervalAt(int dim, int i) const {
+  if (0 <= i && i < bandsLength(dim)) {
+    return ranges_[dim][i].interval;
+  }
+  return Interval::EMPTY;
+}
+
+BandsRegion::Region DaidalusResult::regionAt(int dim, int i) const {
+  if (0 <= i && i < bandsLength(dim)) {
+    return ranges_[dim][i].region;
+  }
+  return BandsRegion::UNKNOWN;
+}
+
+double DaidalusResult::resolution(int dim, bool dir) const {
+  return resolution_[dim][dir ? 1 : 0];
+}
+
+double DaidalusResult::getCurrentTime() const {
+  return current_time_;
+}
+
+const TrafficState& DaidalusResult::getOwnshipState() const {
+  return ownship_;
+}
+
+int DaidalusResult::lastTrafficIndex() const {
+  return traffic_.size();
+}
+
+const TrafficState& DaidalusResult::getAircraftStateAt(int idx) const {
+  if (idx == 0) {
+    return ownship_;
+  }
+  if (1 <= idx && idx <= lastTrafficIndex()) {
+    return traffic_[idx-1];
+  }
+  return TrafficState::INVALID();
+}
+
+int DaidalusResult::alertLevel(int ac_idx) const {
+  if (1 <= ac_idx && ac_idx <= lastTrafficIndex()) {
+    return alert_levels_[ac_idx-1];
+  }
+  return -1;
+}
+
+int DaidalusResult::horizontalDirectionBandsLength() const {
+  return bandsLength(DIRECTION);
+}
+
+Interval DaidalusResult::horizontalDirectionIntervalAt(int i) const {
+  return intervalAt(DIRECTION,i);
+}
+
+BandsRegion::Region DaidalusResult::horizontalDirectionRegionAt(int i) const {
+  return regionAt(DIRECTION,i);
+}
+
+double DaidalusResult::horizontalDirectionResolution(bool dir) const {
+  return resolution(DIRECTION,dir);
+}
+
+bool DaidalusResult::preferredHorizontalDirectionRightOrLeft() const {
+  return preferred_[DIRECTION];
+}
+
+const RecoveryInformation& DaidalusResult::horizontalDirectionRecoveryInformation() const {
+  return recovery_[DIRECTION];
+}
+
+int DaidalusResult::horizontalSpeedBandsLength() const {
+  return bandsLength(HORIZONTAL_SPEED);
+}
+
+Interval DaidalusResult::horizontalSpeedIntervalAt(int i) const {
+  return intervalAt(HORIZONTAL_SPEED,i);
+}
+
+BandsRegion::Region DaidalusResult::horizontalSpeedRegionAt(int i) const {
+  return regionAt(HORIZONTAL_SPEED,i);
+}
+
+double DaidalusResult::horizontalSpeedResolution(bool dir) const {
+  return resolution(HORIZONTAL_SPEED,dir);
+}
+
+bool DaidalusResult::preferredHorizontalSpeedUpOrDown() const {
+  return preferred_[HORIZONTAL_SPEED];
+}
+
+const RecoveryInformation& DaidalusResult::horizontalSpeedRecoveryInformation() const {
+  return recovery_[HORIZONTAL_SPEED];
+}
+
+int DaidalusResult::verticalSpeedBandsLength() const {
+  return bandsLength(VERTICAL_SPEED);
+}
+
+Interval DaidalusResult::verticalSpeedIntervalAt(int i) const {
+  return intervalAt(VERTICAL_SPEED,i);
+}
+
+BandsRegion::Region DaidalusResult::verticalSpeedRegionAt(int i) const {
+  return regionAt(VERTICAL_SPEED,i);
+}
+
+double DaidalusResult::verticalSpeedResolution(bool dir) const {
+  return resolution(VERTICAL_SPEED,dir);
+}
+
+bool DaidalusResult::preferredVerticalSpeedUpOrDown() const {
+  return preferred_[VERTICAL_SPEED];
+}
+
+const RecoveryInformation& DaidalusResult::verticalSpeedRecoveryInformation() const {
+  return recovery_[VERTICAL_SPEED];
+}
+
+int DaidalusResult::altitudeBandsLength() const {
+  return bandsLength(ALTITUDE);
+}
+
+Interval DaidalusResult::altitudeIntervalAt(int i) const {
+  return intervalAt(ALTITUDE,i);
+}
+
+BandsRegion::Region DaidalusResult::altitudeRegionAt(int i) const {
+  return regionAt(ALTITUDE,i);
+}
+
+double DaidalusResult::altitudeResolution(bool dir) const {
+  return resolution(ALTITUDE,dir);
+}
+
+bool DaidalusResult::preferredAltitudeUpOrDown() const {
+  return preferred_[ALTITUDE];
+}
+
+const RecoveryInformation& DaidalusResult::altitudeRecoveryInformation() const {
+  return recovery_[ALTITUDE];
+}
+
+std::string DaidalusResult::toString() const {
+  static const char* names[DIMENSIONS] = {"Horizontal Direction", "Horizontal Speed", "Vertical Speed", "Altitude"};
+  std::string s = "Time: "+FmPrecision(current_time_)+"\n";
+  s += "Ownship: "+ownship_.getId()+"\n";
+  for (int ac=0; ac < static_cast<int>(traffic_.size()); ++ac) {
+    s += "Alert Level "+traffic_[ac].getId()+": "+Fmi(alert_levels_[ac])+"\n";
+  }
+  for (int dim=0; dim < DIMENSIONS; ++dim) {
+    s += std::string(names[dim])+" Bands:";
+    for (int i=0; i < bandsLength(dim); ++i) {
+      s += " "+ranges_[dim][i].toString();
+    }
+    s += "\n";
+    s += std::string(names[dim])+" Resolutions: "+FmPrecision(resolution_[dim][0])+" "+FmPrecision(resolution_[dim][1])+
+        " (preferred: "+Fmb(preferred_[dim])+")\n";
+    s += std::string(names[dim])+" Recovery Information:"+recovery_[dim].toString()+"\n";
+  }
+  return s;
+}
+
+}
@@ -12,15 +12,39 @@
 #include "DaidalusRealBands.h"
 #include "IntervalSet.h"
 #include "Tuple5.h"
+#include "CDCylinder.h"
+#include "Util.h"
+#include "string_util.h"
 #include "Kinematics.h"
 #include "ProjectedKinematics.h"
 #include <vector>
 
 namespace larcfm {
 
-DaidalusVsBands::DaidalusVsBands() {}
+DaidalusVsBands::DaidalusVsBands() : analytic_(1), mismatches_(0) {}
 
-DaidalusVsBands::DaidalusVsBands(const DaidalusVsBands& b) : DaidalusRealBands(b) {}
+DaidalusVsBands::DaidalusVsBands(const DaidalusVsBands& b) : DaidalusRealBands(b), 
+    analytic_(b.analytic_), mismatches_(b.mismatches_.load()) {}
+
+DaidalusVsBands& DaidalusVsBands::operator=(const DaidalusVsBands& b) {
+  DaidalusRealBands::operator=(b);
+  analytic_ = b.analytic_;
+  mismatches_ = b.mismatches_.load();
+  return *this;
+}
+
+void DaidalusVsBands::set_analytic(int mode) {
+  analytic_ = mode;
+  mismatches_ = 0;
+}
+
+int DaidalusVsBands::get_analytic() const {
+  return analytic_;
+}
+
+int DaidalusVsBands::analytic_mismatches() const {
+  return mismatches_.load();
+}
 
 bool DaidalusVsBands::do_recovery(const DaidalusParameters& parameters) const {
   return parameters.isEnabledRecoveryVerticalSpeedBands();
@@ -82,5 +106,159 @@ double DaidalusVsBands::max_delta_resolution(const DaidalusParameters& parameter
   return parameters.getPersistencePreferredVerticalSpeedResolution();
 }
 
+bool DaidalusVsBands::analytic_bands(const Detection3D& conflict_det, const Detection3D& recovery_det,
+    int epsh, int epsv, const DaidalusParameters& parameters) const {
+  return analytic_ > 0 && epsh == 0 && epsv == 0 && instantaneous_bands(parameters) &&
+      (!conflict_det.isValid() || larcfm::equals(conflict_det.getSimpleClassName(),"CDCylinder")) &&
+      (!recovery_det.isValid() || larcfm::equals(recovery_det.getSimpleClassName(),"CDCylinder"));
 }
 
+/*
+ * For a horizontal loss of separation in [t1,t2], the vertical speeds in conflict are those that reach
+ * the bottom and top of the cylinder at some time in [t1,t2] (see Vertical::vs_circle_at). For each time t,
+ * they form an interval whose bounds are monotonic in t, so their union is the interval given by the bounds 
+ * at t1 and t2.
+ */
+void DaidalusVsBands::conflict_steps(int& ka, int& kb, const Detection3D& det, double B, double T, bool dir, int max,
+    const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const {
+  ka = 0;
+  kb = -1;
+  double Tl = Util::min(parameters.getLookaheadTime(),T);
+  if (max < 0 || !det.isValid() || B > Tl) {
+    return;
+  }
+  // Ownship state at step 0, as in CD_future_traj
+  std::pair<Vect3,Vect3> sovo = trajectory(parameters,ownship,0.0,dir,0,true);
+  TrafficState own = ownship;
+  own.setPosition(Position::make(sovo.first));
+  own.setAirVelocity(Velocity::make(sovo.second));
+  const Vect3& vo = own.get_v();
+  const Vect3& vi = traffic.get_v();
+  Vect3 s = own.get_s().Sub(traffic.get_s());
+  Interval hii = det.horizontalInterval(s.vect2(),vo.vect2(),vi.vect2());
+  double t1 = Util::max(hii.low,B);
+  // Violation at time B is checked when B and T are almost equal (see LossData::conflictBetween)
+  double t2 = Util::min(hii.up,Util::almost_equals(B,Tl) ? B : Tl);
+  if (hii.isEmpty() || (t1 > t2 && !Util::almost_equals(t1,t2))) {
+    return;
+  }
+  t2 = Util::max(t1,t2);
+  double H = static_cast<const CDCylinder&>(det).getVerticalSeparation();
+  double sz = s.z();
+  double lo = NINFINITY;
+  double hi = PINFINITY;
+  if (t2 <= 0) {
+    // Loss of separation at time 0 doesn't depend on vertical speed
+    if (std::abs(sz) > H && !Util::almost_equals(std::abs(sz),H)) {
+      return;
+    }
+  } else if (t1 <= 0) {
+    if (sz >= H) {
+      hi = vi.z()+(H-sz)/t2;
+    } else if (sz <= -H) {
+      lo = vi.z()+(-H-sz)/t2;
+    }
+  } else {
+    lo = vi.z()+Util::min((-H-sz)/t1,(-H-sz)/t2);
+    hi = vi.z()+Util::max((H-sz)/t1,(H-sz)/t2);
+  }
+  // Steps k such that vo.z()+k*step (or vo.z()-k*step for down maneuvers) is in (lo,hi)
+  double step = get_step(parameters);
+  double xa = dir ? (lo-vo.z())/step : (vo.z()-hi)/step;
+  double xb = dir ? (hi-vo.z())/step : (vo.z()-lo)/step;
+  ka = (int)Util::min(Util::max(std::floor(xa)+1,0.0),max+1.0);
+  kb = (int)Util::max(Util::min(std::ceil(xb)-1,(double)max),-1.0);
+  if (ka > kb) {
+    // No step is estimated in conflict. Check the steps that are closest to the conflict vertical speeds.
+    int k1 = Util::min(ka,max);
+    int k2 = Util::max(kb,0);
+    if (CD_future_traj(det,B,T,dir,0.0,parameters,ownship,traffic,k1,true)) {
+      ka = kb = k1;
+    } else if (k2 != k1 && CD_future_traj(det,B,T,dir,0.0,parameters,ownship,traffic,k2,true)) {
+      ka = kb = k2;
+    } else {
+      ka = 0;
+      kb = -1;
+      return;
+    }
+  }
+  // Adjust bounds of the range to sampled detection
+  while (ka > 0 && CD_future_traj(det,B,T,dir,0.0,parameters,ownship,traffic,ka-1,true)) {
+    --ka;
+  }
+  while (kb < max && CD_future_traj(det,B,T,dir,0.0,parameters,ownship,traffic,kb+1,true)) {
+    ++kb;
+  }
+  while (ka <= kb && !CD_future_traj(det,B,T,dir,0.0,parameters,ownship,traffic,ka,true)) {
+    ++ka;
+  }
+  while (kb >= ka && !CD_future_traj(det,B,T,dir,0.0,parameters,ownship,traffic,kb,true)) {
+    --kb;
+  }
+}
+
+void DaidalusVsBands::analytic_instantaneous_bands(std::vector<Integerval>& l, const Detection3D& conflict_det, const Detection3D& recovery_det,
+    double B, double T, bool dir, int max,
+    const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const {
+  int ca,cb,ra,rb;
+  conflict_steps(ca,cb,conflict_det,B,T,dir,max,parameters,ownship,traffic);
+  conflict_steps(ra,rb,recovery_det,0,B,dir,max,parameters,ownship,traffic);
+  std::vector<Integerval> red;
+  if (ca <= cb) {
+    red.push_back(Integerval(ca,cb));
+  }
+  if (ra <= rb) {
+    if (!red.empty() && ra < ca) {
+      red.insert(red.begin(),Integerval(ra,rb));
+    } else {
+      red.push_back(Integerval(ra,rb));
+    }
+  }
+  // Conflict free steps are the complement of the conflict steps in [0,max]. As in instantaneous_bands,
+  // a conflict free interval that only contains max is not included.
+  int d = 0;
+  for (std::vector<Integerval>::const_iterator it = red.begin(); it != red.end(); ++it) {
+    if (it->lb > d) {
+      l.push_back(Integerval(d,it->lb-1));
+    }
+    d = Util::max(d,it->ub+1);
+  }
+  if (d < max) {
+    l.push_back(Integerval(d,max));
+  }
+}
+
+/**
+ * When bands are instantaneous and detectors are cylinders, conflict vertical speeds are computed in
+ * closed form per aircraft, rather than sampled at every vertical speed step.
+ */
+void DaidalusVsBands::none_bands(IntervalSet& noneset, const Detection3D& conflict_det, const Detection3D& recovery_det,
+    int epsh, int epsv, double B, double T, const DaidalusParameters& parameters, const TrafficState& ownship, const TrafficState& traffic) const {
+  if (!analytic_bands(conflict_det,recovery_det,epsh,epsv,parameters)) {
+    DaidalusRealBands::none_bands(noneset,conflict_det,recovery_det,epsh,epsv,B,T,parameters,ownship,traffic);
+    return;
+  }
+  int maxl = maxdown(parameters,ownship);
+  int maxr = maxup(parameters,ownship);
+  std::vector<Integerval> l;
+  analytic_instantaneous_bands(l,conflict_det,recovery_det,B,T,false,maxl,parameters,ownship,traffic);
+  std::vector<Integerval> r;
+  analytic_instantaneous_bands(r,conflict_det,recovery_det,B,T,true,maxr,parameters,ownship,traffic);
+  neg(l);
+  append_intband(l,r);
+  if (analytic_ == 2) {
+    std::vector<Integerval> sampled;
+    integer_bands_combine(sampled,conflict_det,recovery_det,0.0,B,T,maxl,maxr,parameters,ownship,traffic,epsh,epsv);
+    bool same = sampled.size() == l.size();
+    for (int i=0; same && i < (int)l.size(); ++i) {
+      same = sampled[i].lb == l[i].lb && sampled[i].ub == l[i].ub;
+    }
+    if (!same) {
+      ++mismatches_;
+      l = sampled;
+    }
+  }
+  toIntervalSet(noneset,l,get_step(parameters),own_val(ownship));
+}
+
+}
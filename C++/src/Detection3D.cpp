@@ -87,6 +87,41 @@ ConflictData Detection3D::conflictDetectionWithTrafficState(const TrafficState&
   return conflictDetection(ownship.get_s(),ownship.get_v(),intruder.get_s(),intruder.get_v(),B,T);
 }
 
+bool Detection3D::hasLossInterval() const {
+  return false;
+}
+
+LossData Detection3D::lossInterval(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi) const {
+  return LossData();
+}
+
+LossData Detection3D::lossIntervalWithTrafficState(const TrafficState& ownship, const TrafficState& intruder) const {
+  return lossInterval(ownship.get_s(),ownship.get_v(),intruder.get_s(),intruder.get_v());
+}
+
+bool Detection3D::hasVerticalInterval() const {
+  return false;
+}
+
+Interval Detection3D::verticalInterval(double sz, double voz, double viz, double B, double T) const {
+  return Interval::EMPTY;
+}
+
+Interval Detection3D::horizontalInterval(const Vect2& s, const Vect2& vo, const Vect2& vi) const {
+  return Interval::EMPTY;
+}
+
+LossData Detection3D::horizontalIntervalWithin(const Interval& ii, const Vect2& s, const Vect2& vo, const Vect2& vi, double B, double T) const {
+  return LossData();
+}
+
+LossData Detection3D::separableLossInterval(const Interval& horizontal, const Interval& vertical) {
+  if (horizontal.isEmpty() || vertical.isEmpty()) {
+    return LossData(PINFINITY,NINFINITY);
+  }
+  return LossData(Util::max(horizontal.low,vertical.low),Util::min(horizontal.up,vertical.up));
+}
+
 void Detection3D::add_blob(std::vector<std::vector<Position> >& blobs, std::vector<Position>& vin, std::vector<Position>& vout) {
   if (vin.empty() && vout.empty()) {
     return;
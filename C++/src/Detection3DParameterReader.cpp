@@ -26,7 +26,8 @@ using std::vector;
 
 namespace larcfm {
 
-std::map<std::string, Detection3D*> Detection3DParameterReader::registeredDetection3DClasses;
+std::unordered_map<std::string, Detection3D*> Detection3DParameterReader::registeredDetection3DClasses;
+std::unordered_map<std::string, ParameterData> Detection3DParameterReader::registeredDetection3DDefaults;
 bool Detection3DParameterReader::registered = false;
 
 void Detection3DParameterReader::registerDefaults() {
@@ -69,10 +70,28 @@ void Detection3DParameterReader::registerDetection3D(const Detection3D* cd) {
 
 void Detection3DParameterReader::registerDetection3D(const Detection3D* cd, const string& name) {
   if (registeredDetection3DClasses.find(name) == registeredDetection3DClasses.end()) {
-    registeredDetection3DClasses[name] = cd->make();
+    Detection3D* prototype = cd->make();
+    registeredDetection3DClasses[name] = prototype;
+    registeredDetection3DDefaults[name] = prototype->getParameters();
   }
 }
 
+bool Detection3DParameterReader::sameParameters(const ParameterData& defaults, const ParameterData& params) {
+  vector<string> keys = params.getKeyList();
+  for (int i = 0; i < (int) keys.size(); i++) {
+    const string& key = keys[i];
+    if (!defaults.contains(key) || params.isNumber(key) != defaults.isNumber(key) ||
+        params.getUnit(key) != defaults.getUnit(key)) {
+      return false;
+    }
+    if (params.isNumber(key) ? params.getValue(key) != defaults.getValue(key) :
+        params.getString(key) != defaults.getString(key)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 Triple<vector<Detection3D*>,Detection3D*,Detection3D*> Detection3DParameterReader::readCoreDetection(const ParameterData& params){
   return readCoreDetection(params,false);
 }
@@ -87,12 +106,15 @@ Triple<vector<Detection3D*>,Detection3D*,Detection3D*> Detection3DParameterReade
     string pname = mlist[i];
     string instanceName = pname.substr(20);
     string dname = params.getString(pname);
-    if (registeredDetection3DClasses.find(dname) != registeredDetection3DClasses.end()) {
-      Detection3D* d = registeredDetection3DClasses[dname]->make();
+    std::unordered_map<std::string, Detection3D*>::const_iterator prototype = registeredDetection3DClasses.find(dname);
+    if (prototype != registeredDetection3DClasses.end()) {
+      Detection3D* d = prototype->second->copy();
       if (verbose) std::cout << ">>>>> Core detection "+dname+" ("<<instanceName<<") loaded <<<<<"<<std::endl;
       ParameterData instpd = params.extractPrefix(instanceName+"_");
       if (instpd.size() > 0) {
-        d->setParameters(instpd);
+        if (!sameParameters(registeredDetection3DDefaults.at(dname),instpd)) {
+          d->setParameters(instpd);
+        }
         if (verbose) std::cout << ">>>>> Core detection parameters for "<<instanceName<<" set <<<<<"<<std::endl;
       }
       if (equals(d->getIdentifier(),"")) {
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "EncounterMetrics.h"
+#include "Horizontal.h"
+#include "Vertical.h"
+#include "Util.h"
+#include "format.h"
+#include <cmath>
+
+namespace larcfm {
+
+EncounterMetrics::EncounterMetrics() :
+    s(Vect3::INVALID()),
+    v(Vect3::INVALID()),
+    alerter_index(-1),
+    horizontal_separation(NaN),
+    vertical_separation(NaN),
+    horizontal_closure_rate(NaN),
+    vertical_closure_rate(NaN),
+    hmd(NaN),
+    vmd(NaN),
+    tcpa(NaN),
+    dcpa(NaN),
+    tcoa(NaN) {}
+
+EncounterMetrics::EncounterMetrics(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi, int alerter_idx, double T) :
+    s(so.Sub(si)),
+    v(vo.Sub(vi)),
+    alerter_index(alerter_idx) {
+  compute(T);
+}
+
+EncounterMetrics::EncounterMetrics(const Vect3& rel_s, const Vect3& rel_v, int alerter_idx, double T) :
+    s(rel_s),
+    v(rel_v),
+    alerter_index(alerter_idx) {
+  compute(T);
+}
+
+void EncounterMetrics::compute(double T) {
+  Vect2 s2 = s.vect2();
+  Vect2 v2 = v.vect2();
+  horizontal_separation = s.norm2D();
+  vertical_separation = std::abs(s.z());
+  horizontal_closure_rate = v2.norm();
+  vertical_closure_rate = std::abs(v.z());
+  hmd = Horizontal::hmd(s2,v2,T);
+  vmd = Vertical::vmd(s.z(),v.z(),T);
+  double t = Horizontal::tcpa(s2,v2);
+  tcpa = Util::max(0.0,t);
+  dcpa = t <= 0 ? s2.norm() : s2.AddScal(t,v2).norm();
+  tcoa = Util::almost_equals(v.z(),0.0) ? NINFINITY : Vertical::time_coalt(s.z(),v.z());
+}
+
+const EncounterMetrics& EncounterMetrics::INVALID() {
+  static EncounterMetrics tmp;
+  return tmp;
+}
+
+bool EncounterMetrics::isValid() const {
+  return !s.isInvalid();
+}
+
+double EncounterMetrics::timeToVolume(int alert_level) const {
+  if (1 <= alert_level && alert_level <= static_cast<int>(violations.size())) {
+    return violations[alert_level-1].getTimeIn();
+  }
+  return NaN;
+}
+
+double EncounterMetrics::modifiedTau(double DMOD) const {
+  Vect2 s2 = s.vect2();
+  Vect2 v2 = v.vect2();
+  double sdotv = s2.dot(v2);
+  double dmod2 = Util::sq(DMOD)-s2.sqv();
+  if (dmod2 < 0 && sdotv < 0) {
+    return dmod2/sdotv;
+  }
+  return -1;
+}
+
+std::string EncounterMetrics::toString() const {
+  std::string str = "alerter_index: "+Fmi(alerter_index);
+  str += ", time_to_volume: [";
+  for (int l=0; l < static_cast<int>(violations.size()); ++l) {
+    str += (l > 0 ? ", " : "")+FmPrecision(violations[l].getTimeIn());
+  }
+  str += "], horizontal_separation: "+FmPrecision(horizontal_separation);
+  str += ", vertical_separation: "+FmPrecision(vertical_separation);
+  str += ", horizontal_closure_rate: "+FmPrecision(horizontal_closure_rate);
+  str += ", vertical_closure_rate: "+FmPrecision(vertical_closure_rate);
+  str += ", hmd: "+FmPrecision(hmd);
+  str += ", vmd: "+FmPrecision(vmd);
+  str += ", tcpa: "+FmPrecision(tcpa);
+  str += ", dcpa: "+FmPrecision(dcpa);
+  str += ", tcoa: "+FmPrecision(tcoa);
+  return str;
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "EncounterMetricsTable.h"
+#include "Util.h"
+
+namespace larcfm {
+
+void EncounterMetricsTable::clear() {
+  id.clear();
+  alerter_index.clear();
+  for (int l=0; l < static_cast<int>(time_to_volume.size()); ++l) {
+    time_to_volume[l].clear();
+  }
+  horizontal_separation.clear();
+  vertical_separation.clear();
+  horizontal_closure_rate.clear();
+  vertical_closure_rate.clear();
+  hmd.clear();
+  vmd.clear();
+  tcpa.clear();
+  dcpa.clear();
+  tcoa.clear();
+}
+
+void EncounterMetricsTable::add(const std::string& ac_id, const EncounterMetrics& m) {
+  int row = size();
+  int levels = m.violations.size();
+  if (static_cast<int>(time_to_volume.size()) < levels) {
+    // New columns are filled with NaN for previous rows
+    time_to_volume.resize(levels,std::vector<double>(row,NaN));
+  }
+  for (int l=0; l < static_cast<int>(time_to_volume.size()); ++l) {
+    time_to_volume[l].push_back(m.timeToVolume(l+1));
+  }
+  id.push_back(ac_id);
+  alerter_index.push_back(m.alerter_index);
+  horizontal_separation.push_back(m.horizontal_separation);
+  vertical_separation.push_back(m.vertical_separation);
+  horizontal_closure_rate.push_back(m.horizontal_closure_rate);
+  vertical_closure_rate.push_back(m.vertical_closure_rate);
+  hmd.push_back(m.hmd);
+  vmd.push_back(m.vmd);
+  tcpa.push_back(m.tcpa);
+  dcpa.push_back(m.dcpa);
+  tcoa.push_back(m.tcoa);
+}
+
+int EncounterMetricsTable::size() const {
+  return id.size();
+}
+
+}
@@ -22,15 +22,12 @@ int ErrorLog::global_purge_flag = 0;
 int ErrorLog::limit = 25;
 
 ErrorLog::ErrorLog(const string& logname) :
-	name(logname),
-	message("") {
-	//this->name = string(name);
-	//message = "";
+	name(logname) {
+	truncated = false;
 	has_error = false;
 	fail_fast = false;
 	console_out = false;
 	local_purge_flag = global_purge_flag;
-	size = 0;
 }
 
 void ErrorLog::setFailFast(bool ff) {
@@ -41,58 +38,90 @@ void ErrorLog::setConsoleOutput(bool console) {
 	console_out = console;
 }
 
-void ErrorLog::addError(const string& msg) {
+void ErrorLog::checkPurge(bool warning) {
 	if (local_purge_flag != global_purge_flag) {
-		message = "";
+		entries.clear();
+		truncated = false;
+		if (warning) {
+			has_error = false;
+		}
 		local_purge_flag = global_purge_flag;
 	}
-	//fpln(" $$$$ ErrorLog: addError: "+msg);
-	has_error = true;
-	message += "ERROR in ";
-	message += name;
-	message += ": ";
-	message += msg;
-	message += "\n";
-	if (fail_fast) {
-		cout << message;
+}
+
+/**
+ * Store a message. Only the last limit messages are kept, older ones are replaced
+ * by "[...] " at the beginning of the log.
+ */
+void ErrorLog::add(const Entry& entry) {
+	checkPurge(!entry.error);
+	if (entry.error) {
+		has_error = true;
+	}
+	entries.push_back(entry);
+	if (fail_fast && entry.error) {
+		cout << getMessageNoClear();
 		exit(1);
 	}
 	if (console_out) {
-		cout << "ERROR in " << name << ": " << msg << endl;
+		string msg;
+		formatEntry(msg,entry);
+		cout << msg << flush;
 	}
-	size++;
-	if (size > limit) {
-		size_t idx = message.find("\n");
-		message.erase(0, idx);
-		message.insert(0,"[...] ");
-		size--;
+	while (!entries.empty() && static_cast<int>(entries.size()) > limit) {
+		entries.pop_front();
+		truncated = true;
 	}
-
 }
 
-void ErrorLog::addWarning(const string& msg) {
-	if (local_purge_flag != global_purge_flag) {
-		message = "";
-		has_error = false;
-		local_purge_flag = global_purge_flag;
-	}
-	message += "Warning in ";
-	message += name;
-	message += ": ";
-	message += msg;
-	message += "\n";
-	if (console_out) {
-		cout << "Warning in " << name << ": " << msg << endl;
+void ErrorLog::formatEntry(string& out, const Entry& entry) const {
+	out += entry.error ? "ERROR in " : "Warning in ";
+	out += name;
+	out += ": ";
+	if (entry.code == TEXT) {
+		out += entry.text;
+	} else {
+		formatCheck(out,entry.code,entry.method,entry.val,entry.lb,entry.ub);
 	}
-	size++;
-	if (size > limit) {
-		size_t idx = message.find("\n");
-		message.erase(0, idx);
-		message.insert(0,"[...] ");
-		size--;
+	out += "\n";
+}
+
+void ErrorLog::formatCheck(string& out, Code code, const char* method, double val, double lb, double ub) {
+	out += "[";
+	out += method;
+	out += "] Value ";
+	out += Fm4(val);
+	switch (code) {
+	case NON_POSITIVE:
+		out += " is non positive";
+		break;
+	case NEGATIVE:
+		out += " is negative";
+		break;
+	case POSITIVE:
+		out += " is positive";
+		break;
+	case NOT_LESS_THAN:
+		out += " is greater or equal than "+Fm4(ub);
+		break;
+	case NOT_BETWEEN:
+		out += " is not between "+Fm4(lb)+" and "+Fm4(ub);
+		break;
+	default:
+		break;
 	}
 }
 
+void ErrorLog::addError(const string& msg) {
+	Entry entry = {true,TEXT,NULL,0.0,0.0,0.0,msg};
+	add(entry);
+}
+
+void ErrorLog::addWarning(const string& msg) {
+	Entry entry = {false,TEXT,NULL,0.0,0.0,0.0,msg};
+	add(entry);
+}
+
 void ErrorLog::addReporter(ErrorReporter& reporter) {
 	if (reporter.hasError()) {
 		addError(reporter.getMessage());
@@ -113,14 +142,29 @@ void ErrorLog::setSizeLimit(int sz) {
 	limit = sz;
 }
 
+bool ErrorLog::failCheck(const std::string& method, Code code, double val, double lb, double ub) {
+	string msg;
+	formatCheck(msg,code,method.c_str(),val,lb,ub);
+	addError(msg);
+	return false;
+}
+
+bool ErrorLog::failCheck(const char* method, Code code, double val, double lb, double ub) {
+	Entry entry = {true,code,method,val,lb,ub,""};
+	add(entry);
+	return false;
+}
+
 /**
  * Checks if a value is positive and, in that case, returns true. Otherwise,
  * adds an error message and returns false.
  */
 bool ErrorLog::isPositive(const std::string& method, double val) {
-	if (val > 0) return true;
-	addError("["+method+"] Value "+Fm4(val)+" is non positive");
-	return false;
+	return val > 0 || failCheck(method,NON_POSITIVE,val,0.0,0.0);
+}
+
+bool ErrorLog::isPositive(const char* method, double val) {
+	return val > 0 || failCheck(method,NON_POSITIVE,val,0.0,0.0);
 }
 
 /**
@@ -128,9 +172,11 @@ bool ErrorLog::isPositive(const std::string& method, double val) {
  * adds an error message and returns false.
  */
 bool ErrorLog::isNonNegative(const std::string& method, double val) {
-	if (val >= 0) return true;
-	addError("["+method+"] Value "+Fm4(val)+" is negative");
-	return false;
+	return val >= 0 || failCheck(method,NEGATIVE,val,0.0,0.0);
+}
+
+bool ErrorLog::isNonNegative(const char* method, double val) {
+	return val >= 0 || failCheck(method,NEGATIVE,val,0.0,0.0);
 }
 
 /**
@@ -138,9 +184,11 @@ bool ErrorLog::isNonNegative(const std::string& method, double val) {
  * adds an error message and returns false.
  */
 bool ErrorLog::isNonPositive(const std::string& method, double val) {
-	if (val <= 0) return true;
-	addError("["+method+"] Value "+Fm4(val)+" is positive");
-	return false;
+	return val <= 0 || failCheck(method,POSITIVE,val,0.0,0.0);
+}
+
+bool ErrorLog::isNonPositive(const char* method, double val) {
+	return val <= 0 || failCheck(method,POSITIVE,val,0.0,0.0);
 }
 
 /**
@@ -148,9 +196,11 @@ bool ErrorLog::isNonPositive(const std::string& method, double val) {
  * adds an error message and returns false.
  */
 bool ErrorLog::isLessThan(const std::string& method, double val, double thr) {
-	if (val < thr) return true;
-	addError("["+method+"] Value "+Fm4(val)+" is greater or equal than "+Fm4(thr));
-	return false;
+	return val < thr || failCheck(method,NOT_LESS_THAN,val,0.0,thr);
+}
+
+bool ErrorLog::isLessThan(const char* method, double val, double thr) {
+	return val < thr || failCheck(method,NOT_LESS_THAN,val,0.0,thr);
 }
 
 /**
@@ -158,9 +208,11 @@ bool ErrorLog::isLessThan(const std::string& method, double val, double thr) {
  * and returns false.
  */
 bool ErrorLog::isBetween(const std::string& method, double val, double lb, double ub) {
-	if (lb <= val && val <= ub) return true;
-	addError("["+method+"] Value "+Fm4(val)+" is not between "+Fm4(lb)+" and "+Fm4(ub));
-	return false;
+	return (lb <= val && val <= ub) || failCheck(method,NOT_BETWEEN,val,lb,ub);
+}
+
+bool ErrorLog::isBetween(const char* method, double val, double lb, double ub) {
+	return (lb <= val && val <= ub) || failCheck(method,NOT_BETWEEN,val,lb,ub);
 }
 
 // Interface methods
@@ -170,19 +222,29 @@ bool ErrorLog::hasError() const {
 }
 
 bool ErrorLog::hasMessage() const {
-	return message.length() > 0;
+	return !entries.empty();
 }
 
 string ErrorLog::getMessage() {
 	has_error = false;
 	string rtn = getMessageNoClear();
-	message = "";
-	size = 0;
+	entries.clear();
+	truncated = false;
 	return rtn;
 }
 
 string ErrorLog::getMessageNoClear() const {
-	return message;
+	string rtn;
+	if (entries.empty()) {
+		return rtn;
+	}
+	if (truncated) {
+		rtn += "[...] \n";
+	}
+	for (std::deque<Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it) {
+		formatEntry(rtn,*it);
+	}
+	return rtn;
 }
 
 void ErrorLog::setName(const std::string& logname) {
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "Executor.h"
+#include "SerialExecutor.h"
+#ifndef DAIDALUS_SERIAL_EXECUTOR
+#include "WorkStealingExecutor.h"
+#include <thread>
+#endif
+#include "Util.h"
+
+namespace larcfm {
+
+void Executor::run_range(const std::function<void(int)>& body, int first, int last, TaskGroup& group) {
+  for (int i = first; i < last && !group.isCancelled(); ++i) {
+    body(i);
+  }
+}
+
+void Executor::parallel_for(int first, int last, const std::function<void(int)>& body, TaskGroup& group) {
+  int n = last-first;
+  if (n <= 0) {
+    return;
+  }
+  // A few chunks per thread balance the load without a task per iteration
+  int chunks = Util::min(n,4*Util::max(1,concurrency()));
+  for (int c = 0; c < chunks; ++c) {
+    submit(group,std::bind(&Executor::run_range,body,first+n*c/chunks,first+n*(c+1)/chunks,std::ref(group)));
+  }
+  wait(group);
+}
+
+void Executor::parallel_for(int first, int last, const std::function<void(int)>& body) {
+  TaskGroup group;
+  parallel_for(first,last,body,group);
+}
+
+Executor& Executor::defaultExecutor() {
+#ifdef DAIDALUS_SERIAL_EXECUTOR
+  static SerialExecutor executor;
+#else
+  static WorkStealingExecutor executor(Util::max(1,(int)std::thread::hardware_concurrency()));
+#endif
+  return executor;
+}
+
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "FleetShards.h"
+#include "GreatCircle.h"
+#include "Alerter.h"
+#include "Detection3D.h"
+#include "Util.h"
+#include "format.h"
+#include <algorithm>
+#include <cmath>
+
+namespace larcfm {
+
+FleetShards::FleetShards(double reach) : reach_(reach), latlon_(true) {}
+
+int FleetShards::numberOfShards() const {
+  return bounds_.size()+1;
+}
+
+double FleetShards::getReach() const {
+  return reach_;
+}
+
+void FleetShards::setReach(double reach) {
+  reach_ = reach;
+}
+
+double FleetShards::coordinate(const Position& p) {
+  return p.isLatLon() ? p.lon() : p.x();
+}
+
+void FleetShards::balance(int n, const std::vector<Position>& positions) {
+  bounds_.clear();
+  if (!positions.empty()) {
+    latlon_ = positions[0].isLatLon();
+  }
+  std::vector<double> coords;
+  for (int i=0; i < static_cast<int>(positions.size()); ++i) {
+    coords.push_back(coordinate(positions[i]));
+  }
+  std::sort(coords.begin(),coords.end());
+  for (int k=1; k < n; ++k) {
+    if (coords.empty()) {
+      bounds_.push_back(0.0);
+    } else {
+      bounds_.push_back(coords[(k*coords.size())/n]);
+    }
+  }
+}
+
+double FleetShards::imbalance(const std::vector<Position>& positions) const {
+  if (positions.empty()) {
+    return 1.0;
+  }
+  std::vector<int> count(numberOfShards(),0);
+  for (int i=0; i < static_cast<int>(positions.size()); ++i) {
+    ++count[shardOf(positions[i])];
+  }
+  return *std::max_element(count.begin(),count.end())*numberOfShards()/static_cast<double>(positions.size());
+}
+
+int FleetShards::shardOf(const Position& p) const {
+  return std::upper_bound(bounds_.begin(),bounds_.end(),coordinate(p))-bounds_.begin();
+}
+
+double FleetShards::distance_to_boundary(const Position& p, double b) const {
+  if (p.isLatLon()) {
+    // Distance to the meridian of longitude b
+    double dlon = std::abs(Util::to_pi(p.lon()-b));
+    if (dlon >= Pi/2) {
+      return PINFINITY;
+    }
+    return GreatCircle::spherical_earth_radius*Util::asin_safe(std::cos(p.lat())*std::sin(dlon));
+  }
+  return std::abs(p.x()-b);
+}
+
+bool FleetShards::inHalo(int shard, const Position& p) const {
+  int n = numberOfShards();
+  if (n == 1 || shardOf(p) == shard) {
+    return true;
+  }
+  if (shard > 0 && distance_to_boundary(p,bounds_[shard-1]) <= reach_) {
+    return true;
+  }
+  if (shard < n-1 && distance_to_boundary(p,bounds_[shard]) <= reach_) {
+    return true;
+  }
+  // First and last shards are adjacent at the antimeridian
+  return latlon_ && (shard == 0 || shard == n-1) && distance_to_boundary(p,Pi) <= reach_;
+}
+
+double FleetShards::alertingReach(const Daidalus& daa, double closure_speed) {
+  double speed = closure_speed > 0 ? closure_speed : 2*daa.getMaxHorizontalSpeed();
+  double reach = 0.0;
+  for (int alerter_idx=1; alerter_idx <= daa.numberOfAlerters(); ++alerter_idx) {
+    const Alerter& alerter = daa.getAlerterAt(alerter_idx);
+    for (int alert_level=1; alert_level <= alerter.mostSevereAlertLevel(); ++alert_level) {
+      const Detection3D& detector = alerter.getDetector(alert_level);
+      if (!detector.isValid()) {
+        continue;
+      }
+      // Intruder at distance d, approaching head-on at given speed, is in violation within 1 second
+      double lo = 0.0;
+      double hi = 1.0;
+      while (hi < 1E7 && detector.conflictDetection(Vect3::ZERO(),Vect3::ZERO(),
+          Vect3(hi,0,0),Vect3(-speed,0,0),0.0,1.0).conflict()) {
+        lo = hi;
+        hi *= 2;
+      }
+      for (int i=0; i < 50; ++i) {
+        double d = (lo+hi)/2;
+        if (detector.conflictDetection(Vect3::ZERO(),Vect3::ZERO(),Vect3(d,0,0),Vect3(-speed,0,0),0.0,1.0).conflict()) {
+          lo = d;
+        } else {
+          hi = d;
+        }
+      }
+      reach = Util::max(reach,hi);
+    }
+  }
+  return daa.getLookaheadTime()*speed+reach;
+}
+
+std::string FleetShards::toString() const {
+  std::string s = "reach: "+FmPrecision(reach_)+", shards: "+Fmi(numberOfShards())+", bounds: [";
+  for (int i=0; i < static_cast<int>(bounds_.size()); ++i) {
+    s += (i > 0 ? ", " : "")+FmPrecision(bounds_[i]);
+  }
+  return s+"]";
+}
+
+}
@@ -61,6 +61,16 @@ double GreatCircle::distance(const LatLonAlt& p1, const LatLonAlt& p2) {
 }
 
 
+double GreatCircle::angular_distance_est(const LatLonAlt& p1, const LatLonAlt& p2) {
+	double x = to_pi(p2.lon()-p1.lon())*cos((p1.lat()+p2.lat())/2.0);
+	double y = p2.lat()-p1.lat();
+	return std::sqrt(x*x+y*y);
+}
+
+double GreatCircle::distance_est(const LatLonAlt& p1, const LatLonAlt& p2) {
+	return distance_from_angle(angular_distance_est(p1, p2), 0.0);
+}
+
 bool GreatCircle::almost_equals(double lat1, double lon1, double lat2, double lon2) {
 	return Constants::almost_equals_radian(angular_distance(lat1, lon1, lat2, lon2));
 }
@@ -119,6 +129,16 @@ double GreatCircle::initial_course(const LatLonAlt& p1, const LatLonAlt& p2) {
 }
 
 
+double GreatCircle::initial_course_est(const LatLonAlt& p1, const LatLonAlt& p2) {
+	if (cos(p1.lat()) < EPS) {
+		return initial_course_impl(p1, p2);
+	}
+	double dlon = to_pi(p2.lon()-p1.lon());
+	double mid_lat = (p1.lat()+p2.lat())/2.0;
+	// Rhumb line course corrected by the convergence of meridians between the two points
+	return to_2pi(atan2_safe(dlon*cos(mid_lat), p2.lat()-p1.lat()) - dlon*sin(mid_lat)/2.0);
+}
+
 double GreatCircle::final_course(const LatLonAlt& p1, const LatLonAlt& p2) {
 	return initial_course(p2, p1)+M_PI;
 }
@@ -515,6 +535,21 @@ LatLonAlt GreatCircle::linear_initial(const LatLonAlt& s, double track, double d
 	return linear_initial_impl(s, track, GreatCircle::angle_from_distance(dist), 0.0);
 }
 
+LatLonAlt GreatCircle::linear_initial_est(const LatLonAlt& s, double dn, double de) {
+	// Second order correction accounting for the convergence of meridians along the great circle
+	double k = tan(s.lat())/(2.0*spherical_earth_radius);
+	double lat = s.lat() + (dn - k*de*de)/spherical_earth_radius;
+	double cos_mid = cos((s.lat()+lat)/2.0);
+	if (cos_mid < EPS) {
+		return linear_initial(s, atan2_safe(de, dn), std::sqrt(dn*dn+de*de));
+	}
+	return LatLonAlt::mk(lat, to_pi(s.lon() + (de + k*dn*de)/(spherical_earth_radius*cos_mid)), s.alt());
+}
+
+LatLonAlt GreatCircle::linear_initial_est(const LatLonAlt& s, const Velocity& v, double t) {
+	return linear_initial_est(s, v.y()*t, v.x()*t).mkAlt(s.alt()+v.z()*t);
+}
+
 double GreatCircle::cross_track_distance(const LatLonAlt& p1, const LatLonAlt& p2, const LatLonAlt& offCircle) {
 	double dist_p1oc = angular_distance(p1,offCircle);
 	double trk_p1oc = initial_course_impl(p1,offCircle); //,dist_p1oc);
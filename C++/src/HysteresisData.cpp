@@ -129,4 +129,33 @@ std::string HysteresisData::toString() const {
 }
 
 
+void HysteresisData::writeState(StateBuffer& buf) const {
+  mofn_.writeState(buf);
+  buf.writeDouble(hysteresis_time_);
+  buf.writeDouble(persistence_time_);
+  buf.writeDouble(init_time_);
+  buf.writeDouble(last_time_);
+  buf.writeInt(last_value_);
+  buf.writeBool(outdated_);
+}
+
+bool HysteresisData::readState(StateBuffer& buf) {
+  mofn_.readState(buf);
+  hysteresis_time_ = buf.readDouble();
+  persistence_time_ = buf.readDouble();
+  init_time_ = buf.readDouble();
+  last_time_ = buf.readDouble();
+  last_value_ = buf.readInt();
+  outdated_ = buf.readBool();
+  return !buf.hasError();
+}
+
+int HysteresisData::memoryUsage() const {
+  return mofn_.memoryUsage();
+}
+
+bool HysteresisData::isExpired(double current_time) const {
+  return ISNAN(last_time_) || current_time-last_time_ > hysteresis_time_;
+}
+
 } /* namespace larcfm */
@@ -46,6 +46,10 @@ std::pair<LatLonAlt,Velocity> KinematicsLatLon::linear(std::pair<LatLonAlt,Veloc
 	return std::pair<LatLonAlt,Velocity>(linear(s0,v0,t).first,v0);
 }
 
+std::pair<LatLonAlt,Velocity> KinematicsLatLon::linearEst(const LatLonAlt& so, const Velocity& vo, double t) {
+	return std::pair<LatLonAlt,Velocity>(GreatCircle::linear_initial_est(so, vo, t),vo);
+}
+
   double KinematicsLatLon::turnRadiusByRate(double speed, double omega) {
     double R = Kinematics::turnRadiusByRate(speed, omega);
     return GreatCircle::surface_distance(R*2)/2.0;
@@ -70,6 +74,15 @@ std::pair<LatLonAlt,Velocity> KinematicsLatLon::turnOmega(const LatLonAlt& so, c
 	return std::pair<LatLonAlt,Velocity>(sn,vn);
 }
 
+std::pair<LatLonAlt,Velocity> KinematicsLatLon::turnOmegaEst(const LatLonAlt& so, const Velocity& vo, double t, double omega) {
+	if (Util::almost_equals(omega,0)) {
+		return linearEst(so,vo,t);
+	}
+	std::pair<Vect3,Velocity> svn = Kinematics::turnOmega(Vect3::ZERO(), vo, t, omega);
+	const Vect3& sn = svn.first;
+	return std::pair<LatLonAlt,Velocity>(GreatCircle::linear_initial_est(so,sn.y(),sn.x()).mkAlt(so.alt()+sn.z()),svn.second);
+}
+
 std::pair<LatLonAlt,Velocity> KinematicsLatLon::turnOmega(std::pair<LatLonAlt,Velocity> sv0, double t, double omega) {
 	if (Util::almost_equals(omega,0))
 		return linear(sv0,t);
@@ -61,6 +61,24 @@ bool LossData::conflict(double thr) const {
 	return conflictLastMoreThan(thr);
 }
 
+/**
+ * Returns true if there is a conflict between times B and T, assuming that this object
+ * is an unbounded loss interval. Intervals are cut at [B,T] as in CD3D::detection.
+ */
+bool LossData::conflictBetween(double B, double T) const {
+	bool instant = Util::almost_equals(B,T);
+	if (instant) {
+		// Violation at time B is checked in [B,B+1] (see Detection3D::conflict)
+		T = B+1;
+	}
+	if (B < 0 || B >= T) {
+		return false;
+	}
+	double tin = Util::min(Util::max(time_in,B),T);
+	double tout = Util::max(Util::min(time_out,T),B);
+	return Util::almost_less(tin,tout) && (!instant || Util::almost_equals(tin,B));
+}
+
 /**
  * Returns time to first loss in seconds.
  */
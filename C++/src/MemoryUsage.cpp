@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "MemoryUsage.h"
+#include "Detection3D.h"
+#include "WCV_tvar.h"
+#include "WCV_TAUMOD_SUM.h"
+#include "WCV_VMOD.h"
+#include "CDCylinder.h"
+#include "TCAS3D.h"
+#include "format.h"
+#include "string_util.h"
+
+namespace larcfm {
+
+// Entry of a units map, where keys and units are short strings
+static const int UNITS_ENTRY_BYTES = 4*sizeof(void*)+2*sizeof(std::string);
+// Number of units kept by WCV tables (DTHR, ZTHR, TTHR, TCOA) and cylinders (D, H)
+static const int WCV_TABLE_UNITS = 4;
+static const int CYLINDER_UNITS = 2;
+// TCAS tables: threshold vectors per sensitivity level and their units
+static const int TCAS_TABLE_VECTORS = 6;
+static const int TCAS_TABLE_LEVELS = 8;
+static const int TCAS_TABLE_UNITS = 5;
+
+MemoryUsage::MemoryUsage() : object(0), parameters(0), traffic(0), alerting_hysteresis(0), bands_hysteresis(0),
+    core_caches(0), bands_caches(0) {}
+
+int MemoryUsage::total() const {
+  return object+parameters+traffic+alerting_hysteresis+bands_hysteresis+core_caches+bands_caches;
+}
+
+std::string MemoryUsage::toString() const {
+  std::string s = "";
+  s += "object: "+Fmi(object)+" [B]\n";
+  s += "parameters: "+Fmi(parameters)+" [B]\n";
+  s += "traffic: "+Fmi(traffic)+" [B]\n";
+  s += "alerting_hysteresis: "+Fmi(alerting_hysteresis)+" [B]\n";
+  s += "bands_hysteresis: "+Fmi(bands_hysteresis)+" [B]\n";
+  s += "core_caches: "+Fmi(core_caches)+" [B]\n";
+  s += "bands_caches: "+Fmi(bands_caches)+" [B]\n";
+  s += "total: "+Fmi(total())+" [B]\n";
+  return s;
+}
+
+int MemoryUsage::string_bytes(const std::string& s) {
+  return s.capacity() > SHORT_STRING_CAPACITY ? static_cast<int>(s.capacity())+1 : 0;
+}
+
+int MemoryUsage::vector_bytes(const std::vector<bool>& v) {
+  return static_cast<int>((v.capacity()+7)/8);
+}
+
+int MemoryUsage::units_bytes(const std::map<std::string,std::string>& units) {
+  int bytes = map_bytes(units);
+  std::map<std::string,std::string>::const_iterator ptr;
+  for (ptr = units.begin(); ptr != units.end(); ++ptr) {
+    bytes += string_bytes(ptr->first)+string_bytes(ptr->second);
+  }
+  return bytes;
+}
+
+int MemoryUsage::detector_bytes(const Detection3D& det) {
+  int bytes = string_bytes(det.getIdentifier());
+  if (equals(det.getSimpleSuperClassName(),"WCV_tvar")) {
+    bytes += equals(det.getSimpleClassName(),"WCV_TAUMOD_SUM") ? sizeof(WCV_TAUMOD_SUM) : sizeof(WCV_tvar);
+    bytes += sizeof(WCV_VMOD)+WCV_TABLE_UNITS*UNITS_ENTRY_BYTES;
+  } else if (equals(det.getSimpleClassName(),"CDCylinder")) {
+    bytes += sizeof(CDCylinder)+CYLINDER_UNITS*UNITS_ENTRY_BYTES;
+  } else if (equals(det.getSimpleClassName(),"TCAS3D")) {
+    bytes += sizeof(TCAS3D)+TCAS_TABLE_VECTORS*TCAS_TABLE_LEVELS*sizeof(double)+TCAS_TABLE_UNITS*UNITS_ENTRY_BYTES;
+  } else {
+    bytes += sizeof(Detection3D);
+  }
+  return bytes;
+}
+
+}
@@ -10,6 +10,7 @@
  */
 
 #include "MofN.h"
+#include "MemoryUsage.h"
 #include "Util.h"
 #include "format.h"
 
@@ -121,4 +122,30 @@ std::string MofN::toString() const {
 }
 
 
+void MofN::writeState(StateBuffer& buf) const {
+  buf.writeInt(m_);
+  buf.writeInt(n_);
+  buf.writeInt(max_);
+  buf.writeInt(queue_.size());
+  for (std::deque<int>::const_iterator it = queue_.begin(); it != queue_.end(); ++it) {
+    buf.writeInt(*it);
+  }
+}
+
+bool MofN::readState(StateBuffer& buf) {
+  m_ = buf.readInt();
+  n_ = buf.readInt();
+  max_ = buf.readInt();
+  int size = buf.readCount(sizeof(int));
+  queue_.clear();
+  for (int i=0; i < size; ++i) {
+    queue_.push_back(buf.readInt());
+  }
+  return !buf.hasError();
+}
+
+int MofN::memoryUsage() const {
+  return MemoryUsage::deque_bytes(queue_);
+}
+
 } /* namespace larcfm */
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "OwnshipScheduler.h"
+#include "EncounterMetrics.h"
+#include "Util.h"
+#include "format.h"
+#include <algorithm>
+#include <utility>
+
+namespace larcfm {
+
+OwnshipScheduler::Entry::Entry() : priority(URGENT), deadline(NINFINITY), missed(false) {}
+
+OwnshipScheduler::OwnshipScheduler() : closure_speed_(NaN) {
+  period_[URGENT] = 0.0;
+  period_[ACTIVE] = 2.0;
+  period_[QUIET] = 10.0;
+  resetStatistics();
+}
+
+void OwnshipScheduler::setPeriod(int priority, double period) {
+  if (0 <= priority && priority < PRIORITIES) {
+    period_[priority] = Util::max(0.0,period);
+  }
+}
+
+double OwnshipScheduler::getPeriod(int priority) const {
+  if (0 <= priority && priority < PRIORITIES) {
+    return period_[priority];
+  }
+  return NaN;
+}
+
+void OwnshipScheduler::setClosureSpeed(double speed) {
+  closure_speed_ = speed;
+}
+
+double OwnshipScheduler::getClosureSpeed() const {
+  return closure_speed_;
+}
+
+double OwnshipScheduler::time_to_proximity(const Daidalus& daa) const {
+  double speed = closure_speed_ > 0 ? closure_speed_ : 2*daa.getMaxHorizontalSpeed();
+  if (!(speed > 0) || daa.lastTrafficIndex() <= 0) {
+    return PINFINITY;
+  }
+  const Vect3& so = daa.getOwnshipState().get_s();
+  double range = PINFINITY;
+  for (int ac=1; ac <= daa.lastTrafficIndex(); ++ac) {
+    range = Util::min(range,so.Sub(daa.getAircraftStateAt(ac).get_s()).norm2D());
+  }
+  // Traffic can't be in conflict within lookahead time before this time
+  return range/speed-daa.getLookaheadTime();
+}
+
+int OwnshipScheduler::inputsUpdated(const std::string& id, const Daidalus& daa) {
+  double time = daa.getCurrentTime();
+  std::map<std::string,Entry>::iterator entry_ptr = entries_.find(id);
+  if (entry_ptr == entries_.end()) {
+    Entry& entry = entries_[id];
+    entry.deadline = time;
+    return entry.priority;
+  }
+  Entry& entry = entry_ptr->second;
+  if (entry.priority == QUIET && time+time_to_proximity(daa) < entry.deadline) {
+    entry.priority = ACTIVE;
+    entry.deadline = time;
+    entry.missed = false;
+  }
+  return entry.priority;
+}
+
+int OwnshipScheduler::completed(const std::string& id, Daidalus& daa) {
+  double time = daa.getCurrentTime();
+  double lookahead = daa.getLookaheadTime();
+  int priority = QUIET;
+  for (int ac=1; ac <= daa.lastTrafficIndex() && priority != URGENT; ++ac) {
+    if (daa.alertLevel(ac) > 0 || daa.timeToCorrectiveVolume(ac) <= lookahead) {
+      priority = URGENT;
+    }
+  }
+  double ttp = PINFINITY;
+  if (priority != URGENT) {
+    int mua = daa.aircraftIndex(daa.mostUrgentAircraft().getId());
+    if (mua > 0) {
+      double tcpa = daa.encounterMetrics(mua).tcpa;
+      if (tcpa > 0 && tcpa <= lookahead) {
+        priority = ACTIVE;
+      }
+    }
+    ttp = time_to_proximity(daa);
+    if (ttp <= period_[ACTIVE]) {
+      priority = ACTIVE;
+    }
+  }
+  Entry& entry = entries_[id];
+  entry.priority = priority;
+  entry.deadline = time+(priority == QUIET ? Util::min(period_[QUIET],ttp) : period_[priority]);
+  entry.missed = false;
+  return priority;
+}
+
+void OwnshipScheduler::remove(const std::string& id) {
+  entries_.erase(id);
+}
+
+void OwnshipScheduler::schedule(double time, int budget, std::vector<std::string>& ids) {
+  ids.clear();
+  std::vector<std::pair<std::pair<int,double>,std::string> > due;
+  std::map<std::string,Entry>::const_iterator entry_ptr;
+  for (entry_ptr = entries_.begin(); entry_ptr != entries_.end(); ++entry_ptr) {
+    if (entry_ptr->second.deadline <= time) {
+      due.push_back(std::make_pair(std::make_pair(entry_ptr->second.priority,entry_ptr->second.deadline),entry_ptr->first));
+    }
+  }
+  std::sort(due.begin(),due.end());
+  for (int i=0; i < static_cast<int>(due.size()); ++i) {
+    Entry& entry = entries_[due[i].second];
+    if (budget < 0 || i < budget) {
+      ids.push_back(due[i].second);
+      ++computations_[entry.priority];
+    } else if (entry.deadline < time && !entry.missed) {
+      ++misses_[entry.priority];
+      entry.missed = true;
+    }
+  }
+}
+
+int OwnshipScheduler::priorityOf(const std::string& id) const {
+  std::map<std::string,Entry>::const_iterator entry_ptr = entries_.find(id);
+  return entry_ptr == entries_.end() ? -1 : entry_ptr->second.priority;
+}
+
+double OwnshipScheduler::deadlineOf(const std::string& id) const {
+  std::map<std::string,Entry>::const_iterator entry_ptr = entries_.find(id);
+  return entry_ptr == entries_.end() ? NaN : entry_ptr->second.deadline;
+}
+
+int OwnshipScheduler::numberOfOwnships(int priority) const {
+  int n = 0;
+  std::map<std::string,Entry>::const_iterator entry_ptr;
+  for (entry_ptr = entries_.begin(); entry_ptr != entries_.end(); ++entry_ptr) {
+    if (entry_ptr->second.priority == priority) {
+      ++n;
+    }
+  }
+  return n;
+}
+
+int OwnshipScheduler::computations(int priority) const {
+  if (0 <= priority && priority < PRIORITIES) {
+    return computations_[priority];
+  }
+  return 0;
+}
+
+int OwnshipScheduler::deadlineMisses(int priority) const {
+  if (0 <= priority && priority < PRIORITIES) {
+    return misses_[priority];
+  }
+  return 0;
+}
+
+void OwnshipScheduler::resetStatistics() {
+  for (int priority=0; priority < PRIORITIES; ++priority) {
+    computations_[priority] = 0;
+    misses_[priority] = 0;
+  }
+}
+
+std::string OwnshipScheduler::toString() const {
+  static const char* names[PRIORITIES] = {"URGENT", "ACTIVE", "QUIET"};
+  std::string s = "";
+  for (int priority=0; priority < PRIORITIES; ++priority) {
+    s += std::string(names[priority])+": period: "+FmPrecision(period_[priority])+
+        ", ownships: "+Fmi(numberOfOwnships(priority))+
+        ", computations: "+Fmi(computations_[priority])+
+        ", deadline misses: "+Fmi(misses_[priority])+"\n";
+  }
+  return s;
+}
+
+}
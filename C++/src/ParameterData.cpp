@@ -115,14 +115,17 @@ std::vector<std::string> ParameterData::getKeyList() const {
 std::vector<std::string> ParameterData::getKeyListEntryOrder() const {
 
 	paramtype::const_iterator pos;
-	std::vector<std::string> keys;
+	// Sort pairs (order,key) instead of looking up the order of each key at every comparison
+	std::vector<std::pair<long,std::string> > entries;
 	for (pos = parameters.begin(); pos != parameters.end(); ++pos) {
-		keys.push_back(pos->first);
+		entries.push_back(std::pair<long,std::string>(pos->second.order,pos->first));
+	}
+	std::stable_sort(entries.begin(), entries.end(), comp_order()); 
+	std::vector<std::string> keys;
+	keys.reserve(entries.size());
+	for (int i = 0; i < (int) entries.size(); ++i) {
+		keys.push_back(entries[i].second);
 	}
-	const paramtype* pt = &parameters;
-	comp_order entryOrderingCompare(pt);
-
-	std::sort(keys.begin(), keys.end(), entryOrderingCompare); // this may be redundant in most cases, due to stability of (most) map implementations.
 	return keys;
 }
 /**
@@ -418,6 +421,58 @@ void ParameterData::copy(const ParameterData& p, bool overwrite) {
 	listCopy(p,p.getKeyListEntryOrder(),overwrite);
 }
 
+static void writeBinaryString(std::ostream& out, const std::string& s) {
+	unsigned int n = static_cast<unsigned int>(s.size());
+	out.write(reinterpret_cast<const char*>(&n),sizeof(n));
+	out.write(s.data(),n);
+}
+
+static bool readBinaryString(std::istream& in, std::string& s) {
+	unsigned int n = 0;
+	if (!in.read(reinterpret_cast<char*>(&n),sizeof(n))) {
+		return false;
+	}
+	s.resize(n);
+	return n == 0 || static_cast<bool>(in.read(&s[0],n));
+}
+
+bool ParameterData::writeBinary(std::ostream& out) const {
+	std::vector<std::string> keys = getKeyListEntryOrder();
+	unsigned int n = static_cast<unsigned int>(keys.size());
+	out.write(reinterpret_cast<const char*>(&n),sizeof(n));
+	for (int i = 0; i < (int) keys.size(); i++) {
+		const ParameterEntry& entry = parameters.find(keys[i])->second;
+		char b = entry.bval ? 1 : 0;
+		writeBinaryString(out,keys[i]);
+		writeBinaryString(out,entry.sval);
+		out.write(reinterpret_cast<const char*>(&entry.dval),sizeof(entry.dval));
+		writeBinaryString(out,entry.units);
+		out.write(&b,1);
+		writeBinaryString(out,entry.comment);
+	}
+	return !out.fail();
+}
+
+bool ParameterData::readBinary(std::istream& in) {
+	unsigned int n = 0;
+	if (!in.read(reinterpret_cast<char*>(&n),sizeof(n))) {
+		return false;
+	}
+	std::string key, sval, units, comment;
+	for (unsigned int i = 0; i < n; i++) {
+		double dval = 0.0;
+		char b = 0;
+		if (!readBinaryString(in,key) || !readBinaryString(in,sval) ||
+				!in.read(reinterpret_cast<char*>(&dval),sizeof(dval)) ||
+				!readBinaryString(in,units) || !in.read(&b,1) || !readBinaryString(in,comment)) {
+			return false;
+		}
+		ParameterEntry entry = ParameterEntry::make(sval,dval,units,b != 0,comment);
+		putParam(key,false,entry);
+	}
+	return true;
+}
+
 /**
  * Remove the given key from this database.  If the key does not exist, do nothing.
  * @param key
@@ -242,6 +242,14 @@ double Position::distanceH(const Position& p) const {
 	}
 }
 
+double Position::distanceHEst(const Position& p) const {
+	if (latlon && p.latlon) {
+		return GreatCircle::distance_est(ll,p.ll);
+	} else {
+		return distanceH(p);
+	}
+}
+
 double Position::distanceV(const Position& p) const {
 	return std::abs(s3.z() - p.s3.z());
 }
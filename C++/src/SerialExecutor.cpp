@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "SerialExecutor.h"
+
+namespace larcfm {
+
+void SerialExecutor::submit(TaskGroup& group, const std::function<void()>& task) {
+  group.add();
+  if (!group.isCancelled()) {
+    task();
+  }
+  group.done();
+}
+
+void SerialExecutor::wait(TaskGroup& group) {
+  // All tasks have already run
+}
+
+int SerialExecutor::concurrency() const {
+  return 1;
+}
+
+}
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "ShadowChecker.h"
+#include "Util.h"
+#include "format.h"
+#include <cmath>
+
+namespace larcfm {
+
+static const char* DIMENSION_NAMES[ShadowChecker::DIMENSIONS] =
+{"Horizontal Direction", "Horizontal Speed", "Vertical Speed", "Altitude"};
+
+ShadowMismatch::ShadowMismatch(const std::string& output, const std::string& fast, const std::string& reference) :
+    output(output), fast(fast), reference(reference) {}
+
+std::string ShadowMismatch::toString() const {
+  return output+": "+fast+" (reference: "+reference+")";
+}
+
+ShadowReport::ShadowReport() : time(NaN) {}
+
+bool ShadowReport::reproduce(Daidalus& daa) const {
+  daa.setParameterData(configuration);
+  return daa.restoreState(state);
+}
+
+std::string ShadowReport::toString() const {
+  std::string s = "Time: "+FmPrecision(time)+", Ownship: "+ownship+"\n";
+  for (int i=0; i < static_cast<int>(mismatches.size()); ++i) {
+    s += "  "+mismatches[i].toString()+"\n";
+  }
+  s += "## Configuration\n"+configuration.toString();
+  s += "## Aircraft States\n"+aircraft_states;
+  s += "## Runtime State: "+Fmi(state.size())+" bytes\n";
+  return s;
+}
+
+ShadowChecker::ShadowChecker(double rate) : time_tolerance_(1E-6), max_reports_(16) {
+  setSamplingRate(rate);
+  for (int dim=0; dim < DIMENSIONS; ++dim) {
+    tolerance_[dim] = 1E-6;
+  }
+  reset();
+}
+
+void ShadowChecker::setSamplingRate(double rate) {
+  rate_ = Util::max(0.0,Util::min(1.0,rate));
+}
+
+double ShadowChecker::getSamplingRate() const {
+  return rate_;
+}
+
+void ShadowChecker::setTolerance(int dim, double tol) {
+  if (0 <= dim && dim < DIMENSIONS) {
+    tolerance_[dim] = Util::max(0.0,tol);
+  }
+}
+
+double ShadowChecker::getTolerance(int dim) const {
+  if (0 <= dim && dim < DIMENSIONS) {
+    return tolerance_[dim];
+  }
+  return NaN;
+}
+
+void ShadowChecker::setTimeTolerance(double tol) {
+  time_tolerance_ = Util::max(0.0,tol);
+}
+
+double ShadowChecker::getTimeTolerance() const {
+  return time_tolerance_;
+}
+
+void ShadowChecker::setMaxReports(int max) {
+  max_reports_ = Util::max(0,max);
+}
+
+int ShadowChecker::getMaxReports() const {
+  return max_reports_;
+}
+
+bool ShadowChecker::check(Daidalus& daa) {
+  ++time_steps_;
+  credit_ += rate_;
+  if (credit_ < 1.0) {
+    return true;
+  }
+  credit_ -= 1.0;
+  return checkNow(daa);
+}
+
+bool ShadowChecker::checkNow(Daidalus& daa) {
+  ++checked_;
+  // Runtime state before daa computes any output of this time step
+  std::string state;
+  daa.serializeState(state);
+  Daidalus reference(daa);
+  reference.setExecutor(serial_);
+  reference.setRecoveryThreads(1);
+  reference.setAnalyticVerticalSpeedBands(0);
+  std::vector<ShadowMismatch> mismatches;
+  if (reference.restoreState(state)) {
+    compare(daa,reference,mismatches);
+  } else {
+    mismatches.push_back(ShadowMismatch("Runtime State","serialized","not restored"));
+  }
+  if (mismatches.empty()) {
+    return true;
+  }
+  ++mismatched_;
+  if (static_cast<int>(reports_.size()) < max_reports_) {
+    ShadowReport report;
+    report.time = daa.getCurrentTime();
+    report.ownship = daa.getOwnshipState().getId();
+    report.configuration = daa.getParameterData();
+    report.state.swap(state);
+    report.aircraft_states = daa.outputStringAircraftStates();
+    report.mismatches.swap(mismatches);
+    reports_.push_back(report);
+  }
+  return false;
+}
+
+int ShadowChecker::timeSteps() const {
+  return time_steps_;
+}
+
+int ShadowChecker::checkedTimeSteps() const {
+  return checked_;
+}
+
+int ShadowChecker::mismatchedTimeSteps() const {
+  return mismatched_;
+}
+
+const std::vector<ShadowReport>& ShadowChecker::getReports() const {
+  return reports_;
+}
+
+void ShadowChecker::reset() {
+  credit_ = 0.0;
+  time_steps_ = 0;
+  checked_ = 0;
+  mismatched_ = 0;
+  reports_.clear();
+}
+
+std::string ShadowChecker::toString() const {
+  std::string s = "Shadow checker: sampling rate "+FmPrecision(rate_)+", time steps "+Fmi(time_steps_)+
+      ", checked "+Fmi(checked_)+", mismatched "+Fmi(mismatched_)+"\n";
+  for (int i=0; i < static_cast<int>(reports_.size()); ++i) {
+    s += reports_[i].toString();
+  }
+  return s;
+}
+
+// Two values agree when both are NaN, both are the same infinity, or they are within tolerance
+bool ShadowChecker::agree(double fast, double reference, double tol) {
+  if (ISNAN(fast) || ISNAN(reference)) {
+    return ISNAN(fast) && ISNAN(reference);
+  }
+  return fast == reference || std::abs(fast-reference) <= tol;
+}
+
+static int bands_length(const DaidalusResult& result, int dim) {
+  switch (dim) {
+  case ShadowChecker::DIRECTION: return result.horizontalDirectionBandsLength();
+  case ShadowChecker::HORIZONTAL_SPEED: return result.horizontalSpeedBandsLength();
+  case ShadowChecker::VERTICAL_SPEED: return result.verticalSpeedBandsLength();
+  default: return result.altitudeBandsLength();
+  }
+}
+
+static Interval interval_at(const DaidalusResult& result, int dim, int i) {
+  switch (dim) {
+  case ShadowChecker::DIRECTION: return result.horizontalDirectionIntervalAt(i);
+  case ShadowChecker::HORIZONTAL_SPEED: return result.horizontalSpeedIntervalAt(i);
+  case ShadowChecker::VERTICAL_SPEED: return result.verticalSpeedIntervalAt(i);
+  default: return result.altitudeIntervalAt(i);
+  }
+}
+
+static BandsRegion::Region region_at(const DaidalusResult& result, int dim, int i) {
+  switch (dim) {
+  case ShadowChecker::DIRECTION: return result.horizontalDirectionRegionAt(i);
+  case ShadowChecker::HORIZONTAL_SPEED: return result.horizontalSpeedRegionAt(i);
+  case ShadowChecker::VERTICAL_SPEED: return result.verticalSpeedRegionAt(i);
+  default: return result.altitudeRegionAt(i);
+  }
+}
+
+std::string ShadowChecker::bands_to_string(const DaidalusResult& result, int dim) {
+  std::string s = "";
+  for (int i=0; i < bands_length(result,dim); ++i) {
+    Interval ii = interval_at(result,dim,i);
+    s += (i > 0 ? " [" : "[")+FmPrecision(ii.low)+", "+FmPrecision(ii.up)+"]"+BandsRegion::to_string(region_at(result,dim,i));
+  }
+  return s;
+}
+
+bool ShadowChecker::bands_agree(const DaidalusResult& fast, const DaidalusResult& reference, int dim, double tol) {
+  if (bands_length(fast,dim) != bands_length(reference,dim)) {
+    return false;
+  }
+  for (int i=0; i < bands_length(fast,dim); ++i) {
+    Interval fast_ii = interval_at(fast,dim,i);
+    Interval ref_ii = interval_at(reference,dim,i);
+    if (region_at(fast,dim,i) != region_at(reference,dim,i) ||
+        !agree(fast_ii.low,ref_ii.low,tol) || !agree(fast_ii.up,ref_ii.up,tol)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+double ShadowChecker::resolution(const DaidalusResult& result, int dim, bool dir) {
+  switch (dim) {
+  case DIRECTION: return result.horizontalDirectionResolution(dir);
+  case HORIZONTAL_SPEED: return result.horizontalSpeedResolution(dir);
+  case VERTICAL_SPEED: return result.verticalSpeedResolution(dir);
+  default: return result.altitudeResolution(dir);
+  }
+}
+
+bool ShadowChecker::preferred(const DaidalusResult& result, int dim) {
+  switch (dim) {
+  case DIRECTION: return result.preferredHorizontalDirectionRightOrLeft();
+  case HORIZONTAL_SPEED: return result.preferredHorizontalSpeedUpOrDown();
+  case VERTICAL_SPEED: return result.preferredVerticalSpeedUpOrDown();
+  default: return result.preferredAltitudeUpOrDown();
+  }
+}
+
+const RecoveryInformation& ShadowChecker::recovery(const DaidalusResult& result, int dim) {
+  switch (dim) {
+  case DIRECTION: return result.horizontalDirectionRecoveryInformation();
+  case HORIZONTAL_SPEED: return result.horizontalSpeedRecoveryInformation();
+  case VERTICAL_SPEED: return result.verticalSpeedRecoveryInformation();
+  default: return result.altitudeRecoveryInformation();
+  }
+}
+
+double ShadowChecker::last_time_to_maneuver(Daidalus& daa, int dim, int ac_idx) {
+  switch (dim) {
+  case DIRECTION: return daa.lastTimeToHorizontalDirectionManeuver(ac_idx);
+  case HORIZONTAL_SPEED: return daa.lastTimeToHorizontalSpeedManeuver(ac_idx);
+  case VERTICAL_SPEED: return daa.lastTimeToVerticalSpeedManeuver(ac_idx);
+  default: return daa.lastTimeToAltitudeManeuver(ac_idx);
+  }
+}
+
+void ShadowChecker::compare(Daidalus& fast, Daidalus& reference, std::vector<ShadowMismatch>& mismatches) const {
+  DaidalusResult fast_result(fast);
+  DaidalusResult ref_result(reference);
+  if (fast_result.lastTrafficIndex() != ref_result.lastTrafficIndex()) {
+    mismatches.push_back(ShadowMismatch("Number of Traffic Aircraft",
+        Fmi(fast_result.lastTrafficIndex()),Fmi(ref_result.lastTrafficIndex())));
+    return;
+  }
+  for (int ac=1; ac <= fast_result.lastTrafficIndex(); ++ac) {
+    if (fast_result.alertLevel(ac) != ref_result.alertLevel(ac)) {
+      mismatches.push_back(ShadowMismatch("Alert Level "+fast_result.getAircraftStateAt(ac).getId(),
+          Fmi(fast_result.alertLevel(ac)),Fmi(ref_result.alertLevel(ac))));
+    }
+  }
+  for (int dim=0; dim < DIMENSIONS; ++dim) {
+    std::string name = DIMENSION_NAMES[dim];
+    if (!bands_agree(fast_result,ref_result,dim,tolerance_[dim])) {
+      mismatches.push_back(ShadowMismatch(name+" Bands",
+          bands_to_string(fast_result,dim),bands_to_string(ref_result,dim)));
+    }
+    for (int d=0; d < 2; ++d) {
+      bool dir = d > 0;
+      double fast_res = resolution(fast_result,dim,dir);
+      double ref_res = resolution(ref_result,dim,dir);
+      if (!agree(fast_res,ref_res,tolerance_[dim])) {
+        mismatches.push_back(ShadowMismatch(name+" Resolution ("+(dir ? "up/right" : "down/left")+")",
+            FmPrecision(fast_res),FmPrecision(ref_res)));
+      }
+    }
+    if (preferred(fast_result,dim) != preferred(ref_result,dim)) {
+      mismatches.push_back(ShadowMismatch(name+" Preferred Direction",
+          Fmb(preferred(fast_result,dim)),Fmb(preferred(ref_result,dim))));
+    }
+    const RecoveryInformation& fast_rec = recovery(fast_result,dim);
+    const RecoveryInformation& ref_rec = recovery(ref_result,dim);
+    if (fast_rec.recoveryBandsComputed() != ref_rec.recoveryBandsComputed() ||
+        fast_rec.recoveryBandsSaturated() != ref_rec.recoveryBandsSaturated() ||
+        fast_rec.nFactor() != ref_rec.nFactor() ||
+        !agree(fast_rec.timeToRecovery(),ref_rec.timeToRecovery(),time_tolerance_)) {
+      mismatches.push_back(ShadowMismatch(name+" Recovery Information",fast_rec.toString(),ref_rec.toString()));
+    }
+    for (int ac=1; ac <= fast_result.lastTrafficIndex(); ++ac) {
+      double fast_lttm = last_time_to_maneuver(fast,dim,ac);
+      double ref_lttm = last_time_to_maneuver(reference,dim,ac);
+      if (!agree(fast_lttm,ref_lttm,time_tolerance_)) {
+        mismatches.push_back(ShadowMismatch(name+" Last Time to Maneuver "+fast_result.getAircraftStateAt(ac).getId(),
+            FmPrecision(fast_lttm),FmPrecision(ref_lttm)));
+      }
+    }
+  }
+}
+
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "StateBuffer.h"
+#include <cstring>
+
+namespace larcfm {
+
+StateBuffer::StateBuffer() : pos_(0), error_(false) {}
+
+StateBuffer::StateBuffer(const std::string& data) : data_(data), pos_(0), error_(false) {}
+
+void StateBuffer::clear() {
+  data_.clear();
+  pos_ = 0;
+  error_ = false;
+}
+
+void StateBuffer::swap(std::string& data) {
+  data_.swap(data);
+  pos_ = 0;
+  error_ = false;
+}
+
+const std::string& StateBuffer::data() const {
+  return data_;
+}
+
+bool StateBuffer::hasError() const {
+  return error_;
+}
+
+void StateBuffer::setError() {
+  error_ = true;
+}
+
+bool StateBuffer::atEnd() const {
+  return pos_ == data_.size();
+}
+
+void StateBuffer::writeInt(int val) {
+  data_.append(reinterpret_cast<const char*>(&val),sizeof(val));
+}
+
+void StateBuffer::writeDouble(double val) {
+  data_.append(reinterpret_cast<const char*>(&val),sizeof(val));
+}
+
+void StateBuffer::writeBool(bool val) {
+  data_.push_back(val ? 1 : 0);
+}
+
+void StateBuffer::writeString(const std::string& val) {
+  writeInt(val.size());
+  data_.append(val);
+}
+
+void StateBuffer::writeVect3(const Vect3& val) {
+  writeDouble(val.x());
+  writeDouble(val.y());
+  writeDouble(val.z());
+}
+
+bool StateBuffer::read(void* val, std::string::size_type size) {
+  if (error_ || data_.size()-pos_ < size) {
+    error_ = true;
+    return false;
+  }
+  std::memcpy(val,data_.data()+pos_,size);
+  pos_ += size;
+  return true;
+}
+
+int StateBuffer::readInt() {
+  int val = 0;
+  read(&val,sizeof(val));
+  return val;
+}
+
+double StateBuffer::readDouble() {
+  double val = 0.0;
+  read(&val,sizeof(val));
+  return val;
+}
+
+bool StateBuffer::readBool() {
+  char val = 0;
+  read(&val,sizeof(val));
+  return val != 0;
+}
+
+std::string StateBuffer::readString() {
+  int size = readCount(1);
+  if (error_) {
+    return "";
+  }
+  std::string val = data_.substr(pos_,size);
+  pos_ += size;
+  return val;
+}
+
+Vect3 StateBuffer::readVect3() {
+  double x = readDouble();
+  double y = readDouble();
+  double z = readDouble();
+  return Vect3(x,y,z);
+}
+
+int StateBuffer::readCount(int min_bytes) {
+  int count = readInt();
+  if (count < 0 || (min_bytes > 0 && static_cast<std::string::size_type>(count) > (data_.size()-pos_)/min_bytes)) {
+    error_ = true;
+    return 0;
+  }
+  return count;
+}
+
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "TaskGroup.h"
+
+namespace larcfm {
+
+TaskGroup::TaskGroup() : pending_(0), cancelled_(false) {}
+
+void TaskGroup::cancel() {
+  cancelled_ = true;
+}
+
+bool TaskGroup::isCancelled() const {
+  return cancelled_;
+}
+
+int TaskGroup::pending() const {
+  return pending_;
+}
+
+void TaskGroup::add() {
+  ++pending_;
+}
+
+void TaskGroup::done() {
+  // The lock is held while decrementing, so that a waiting thread doesn't destroy this group
+  // between the decrement and the notification
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (--pending_ == 0) {
+    finished_.notify_all();
+  }
+}
+
+void TaskGroup::wait_finished() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (pending_ > 0) {
+    finished_.wait(lock);
+  }
+}
+
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "TrafficTable.h"
+#include "SUMData.h"
+#include "MemoryUsage.h"
+#include <utility>
+
+namespace larcfm {
+
+void TrafficTable::clear() {
+  handle.clear();
+  si.clear();
+  vi.clear();
+  s.clear();
+  v.clear();
+  alerter_index.clear();
+  s_EW_std.clear();
+  s_NS_std.clear();
+  s_EN_std.clear();
+  sz_std.clear();
+  v_EW_std.clear();
+  v_NS_std.clear();
+  v_EN_std.clear();
+  vz_std.clear();
+}
+
+void TrafficTable::release() {
+  TrafficTable empty;
+  std::swap(*this,empty);
+}
+
+int TrafficTable::memoryUsage() const {
+  return MemoryUsage::vector_bytes(handle)+MemoryUsage::vector_bytes(si)+MemoryUsage::vector_bytes(vi)+
+      MemoryUsage::vector_bytes(s)+MemoryUsage::vector_bytes(v)+MemoryUsage::vector_bytes(alerter_index)+
+      MemoryUsage::vector_bytes(s_EW_std)+MemoryUsage::vector_bytes(s_NS_std)+MemoryUsage::vector_bytes(s_EN_std)+
+      MemoryUsage::vector_bytes(sz_std)+MemoryUsage::vector_bytes(v_EW_std)+MemoryUsage::vector_bytes(v_NS_std)+
+      MemoryUsage::vector_bytes(v_EN_std)+MemoryUsage::vector_bytes(vz_std);
+}
+
+void TrafficTable::build(const TrafficState& ownship, const std::vector<TrafficState>& traffic) {
+  clear();
+  const Vect3& so = ownship.get_s();
+  const Vect3& vo = ownship.get_v();
+  for (int ac=0; ac < static_cast<int>(traffic.size()); ++ac) {
+    const TrafficState& intruder = traffic[ac];
+    const SUMData& sum = intruder.sum();
+    handle.push_back(ac);
+    si.push_back(intruder.get_s());
+    vi.push_back(intruder.get_v());
+    s.push_back(so.Sub(intruder.get_s()));
+    v.push_back(vo.Sub(intruder.get_v()));
+    alerter_index.push_back(intruder.getAlerterIndex());
+    s_EW_std.push_back(sum.get_s_EW_std());
+    s_NS_std.push_back(sum.get_s_NS_std());
+    s_EN_std.push_back(sum.get_s_EN_std());
+    sz_std.push_back(sum.get_sz_std());
+    v_EW_std.push_back(sum.get_v_EW_std());
+    v_NS_std.push_back(sum.get_v_NS_std());
+    v_EN_std.push_back(sum.get_v_EN_std());
+    vz_std.push_back(sum.get_vz_std());
+  }
+}
+
+int TrafficTable::size() const {
+  return handle.size();
+}
+
+}
@@ -669,7 +669,7 @@ double getd(string str, double def) {
 double Units::parse(const string& defaultUnitsFrom, const std::string& s, double default_value) {
 	double ret = 0.0;
 	std::smatch m;
-	std::regex numre("\\s*([-+0-9\\.]+)\\s*\\[?\\s*([-/^_a-zA-Z0-9]*).*"); //(.*)");   We want to add this unicode character \u00B0 (the degree symbol) to the units part  //TODO: does not recognize e-notation
+	static const std::regex numre("\\s*([-+0-9\\.]+)\\s*\\[?\\s*([-/^_a-zA-Z0-9]*).*"); //(.*)");   We want to add this unicode character \u00B0 (the degree symbol) to the units part  //TODO: does not recognize e-notation
 //	std::regex numre("\\s*([-+0-9\\.]+)\\s*\\[?\\s*([/^_a-zA-Z0-9]*)\\s*\\]?\\s*$"); //(.*)");   We want to add this unicode character \u00B0 (the degree symbol) to the units part
 	//Java: Pattern.compile("\\s*([-+0-9\\.]+)\\s*\\[?\\s*([-\\/^_a-zA-Z0-9\\u00B0]*).*");
 
@@ -716,7 +716,7 @@ double Units::parse(const string& defaultUnitsFrom, const std::string& s, double
 std::string Units::parseUnits(const std::string& s) {
 	std::string unit = "unspecified";
 	std::smatch m;
-	std::regex numre("\\s*([-+0-9\\.]+)\\s*\\[?\\s*([-/^_a-zA-Z0-9]*).*"); //(.*)");   We want to add this unicode character \u00B0 (the degree symbol) to the units part
+	static const std::regex numre("\\s*([-+0-9\\.]+)\\s*\\[?\\s*([-/^_a-zA-Z0-9]*).*"); //(.*)");   We want to add this unicode character \u00B0 (the degree symbol) to the units part
 //	std::regex numre("\\s*([-+0-9\\.]+)\\s*\\[?\\s*([/^_a-zA-Z0-9]*)\\s*\\]?\\s*$"); //(.*)");   We want to add this unicode character \u00B0 (the degree symbol) to the units part
 	//Java: Pattern.compile("\\s*([-+0-9\\.]+)\\s*\\[?\\s*([-\\/^_a-zA-Z0-9\\u00B0]*).*");
 	std::regex_match(s, m, numre);
@@ -729,23 +729,34 @@ std::string Units::parseUnits(const std::string& s) {
 
 #else
 
+/*
+ * Regular expression of a number followed by optional units. It is compiled only once since its compilation
+ * dominates the cost of parsing parameters. POSIX regexec can be called concurrently on the same expression.
+ */
+static const regex_t* number_units_regex() {
+	static regex_t regex;
+	static int reti = regcomp(&regex, "^[[:blank:]]*([-+0-9\\.]+)[[:blank:]]*\\[?[[:blank:]]*([-\\/^_a-zA-Z0-9]*).*", REG_EXTENDED); //[[:blank:]]*\\]?(.*)", REG_EXTENDED); //TODO: does not recognize e-notation
+	//Java: Pattern.compile("\\s*([-+0-9\\.]+)\\s*\\[?\\s*([-\\/^_a-zA-Z0-9\\u00B0]*).*");
+	if (reti != 0) {
+		return NULL;
+	}
+	return &regex;
+}
+
 double Units::parse(const string& defaultUnitsFrom, const std::string& s, double default_value) {
 	double ret = Units::from(defaultUnitsFrom,default_value);
-	regex_t regex;
+	const regex_t* regex = number_units_regex();
 	int reti;
 	char msgbuf[100];
 
-	/* Compile regular expression, use C regular expression library */
-	reti = regcomp(&regex, "^[[:blank:]]*([-+0-9\\.]+)[[:blank:]]*\\[?[[:blank:]]*([-\\/^_a-zA-Z0-9]*).*", REG_EXTENDED); //[[:blank:]]*\\]?(.*)", REG_EXTENDED); //TODO: does not recognize e-notation
-	//Java: Pattern.compile("\\s*([-+0-9\\.]+)\\s*\\[?\\s*([-\\/^_a-zA-Z0-9\\u00B0]*).*");
-	if (reti != 0) {
+	if (regex == NULL) {
 		fdln("Could not compile regex in Units::parse\n");
-		//		DebugSupport::halt();
+		return ret;
 	}
 
 	/* Execute regular expression */
 	regmatch_t matchptr[4];
-	reti = regexec(&regex, s.c_str(), 4, matchptr, 0);
+	reti = regexec(regex, s.c_str(), 4, matchptr, 0);
 	if (!reti) {
 		char match[100];
 		int numchars;
@@ -798,28 +809,22 @@ double Units::parse(const string& defaultUnitsFrom, const std::string& s, double
 	} else if (reti == REG_NOMATCH) {
 		// no match, return default value
 	} else {
-		regerror(reti, &regex, msgbuf, sizeof(msgbuf));
+		regerror(reti, regex, msgbuf, sizeof(msgbuf));
 		string m1(msgbuf);
 		fdln("Regex match failed: "+m1);
 	}
-
-	/* Free compiled regular expression if you want to use the regex_t again */
-	regfree(&regex);
 	return ret;
 }
 
 std::string Units::parseUnits(const std::string& s) {
 	string ret("unspecified");
-	regex_t regex;
+	const regex_t* regex = number_units_regex();
 	int reti;
 	char msgbuf[100];
 
-	/* Compile regular expression */
-	//reti = regcomp(&regex, "^[[:blank:]]*([-+0-9\\.]+)[[:blank:]]*\\[?[[:blank:]]*([/^_a-zA-Z0-9]*)[[:blank:]]*\\]?(.*)", REG_EXTENDED);
-	reti = regcomp(&regex, "^[[:blank:]]*([-+0-9\\.]+)[[:blank:]]*\\[?[[:blank:]]*([-\\/^_a-zA-Z0-9]*).*", REG_EXTENDED); //[[:blank:]]*\\]?(.*)", REG_EXTENDED); //TODO: does not recognize e-notation
-	if (reti != 0) {
+	if (regex == NULL) {
 		fdln("$$$ERROR$$$: Could not compile regex in Units::parseUnits\n");
-//		DebugSupport::halt();
+		return ret;
 	}
 
 	/* Execute regular expression */
@@ -827,7 +832,7 @@ std::string Units::parseUnits(const std::string& s) {
 	char match[100];
 
 	//fpln("input X"+s+"X");
-	reti = regexec(&regex, s.c_str(), 4, matchptr, 0);
+	reti = regexec(regex, s.c_str(), 4, matchptr, 0);
 	if (!reti) {
 		int numchars;
 
@@ -841,13 +846,10 @@ std::string Units::parseUnits(const std::string& s) {
 	} else if (reti == REG_NOMATCH) {
 		// no match, return default value
 	} else {
-		regerror(reti, &regex, msgbuf, sizeof(msgbuf));
+		regerror(reti, regex, msgbuf, sizeof(msgbuf));
 		fprintf(stderr, "$$$ERROR$$$ Regex match failed in Units::parseUnits: %s\n", msgbuf);
 //		DebugSupport::halt();
 	}
-
-	/* Free compiled regular expression if you want to use the regex_t again */
-	regfree(&regex);
 	return ret;
 }
 #endif
@@ -460,27 +460,39 @@ double Util::turnDelta(double alpha, double beta, int dir) {
 bool Util::is_double(const string& str) {
 	std::string sb(str);
 	trim(sb," \t");
-	std::regex numre("^-?[0-9]*(\\.[0-9]*)?$");
+	static const std::regex numre("^-?[0-9]*(\\.[0-9]*)?$");
 	return std::regex_match(sb, numre);
 }
 
 #else
+/*
+ * Regular expression of a decimal number, compiled only once. POSIX regexec can be called 
+ * concurrently on the same expression.
+ */
+static const regex_t* double_regex() {
+	static regex_t regex;
+	static int reti = regcomp(&regex, "^-?[0-9]*(\\.[0-9]*)?$", REG_EXTENDED);
+	if (reti != 0) {
+		fdln("Could not compile regex\n");
+		return NULL;
+	}
+	return &regex;
+}
+
 bool Util::is_double(const string& str) {
 
 	string sb(str);
-	regex_t regex;
+	const regex_t* regex = double_regex();
 	int reti;
 
 	trim(sb," \t");
 
-	reti = regcomp(&regex, "^-?[0-9]*(\\.[0-9]*)?$", REG_EXTENDED);
-	if (reti != 0) {
-		fdln("Could not compile regex\n");
+	if (regex == NULL) {
+		return false;
 	}
 
 	/* Execute regular expression */
-	reti = regexec(&regex, sb.c_str(), 0, NULL, 0);
-	regfree(&regex);
+	reti = regexec(regex, sb.c_str(), 0, NULL, 0);
 	return !reti;
 }
 #endif
@@ -65,6 +65,10 @@ Velocity Velocity::mkTrkGsVs(const double trk, const double gs, const double vs)
 	return Velocity(trk,gs,trkgs2vx(trk,gs),trkgs2vy(trk,gs),vs);
 }
 
+Velocity Velocity::mkTrkGsVxyz(const double trk, const double gs, const double vx, const double vy, const double vz) {
+	return Velocity(trk,gs,vx,vy,vz);
+}
+
 Velocity Velocity::makeTrkGsVs(const double trk, const std::string& utrk,
 		const double gs, const std::string& ugs,
 		const double vs, const std::string& uvs) {
@@ -125,20 +125,26 @@ LossData WCV_tvar::WCV3D(const Vect3& so, const Vect3& vo, const Vect3& si, cons
 
 // Assumes 0 <= B < T
 LossData WCV_tvar::WCV_interval(const Vect3& so, const Vect3& vo, const Vect3& si, const Vect3& vi, double B, double T) const {
-  double time_in = T;
-  double time_out = B;
-
   const Vect2& so2 = so.vect2();
   const Vect2& si2 = si.vect2();
   Vect2 s2 = so2.Sub(si2);
-  const Vect2& vo2 = vo.vect2();
-  const Vect2& vi2 = vi.vect2();
-  Vect2 v2 = vo2.Sub(vi2);
   double sz = so.z()-si.z();
-  double vz = vo.z()-vi.z();
+  return horizontalIntervalWithin(verticalInterval(sz,vo.z(),vi.z(),B,T),s2,vo.vect2(),vi.vect2(),B,T);
+}
+
+bool WCV_tvar::hasVerticalInterval() const {
+  return true;
+}
 
-  Interval ii = wcv_vertical_->vertical_WCV_interval(table_.getZTHR(),table_.getTCOA(),B,T,sz,vz);
+Interval WCV_tvar::verticalInterval(double sz, double voz, double viz, double B, double T) const {
+  double vz = voz-viz;
+  return wcv_vertical_->vertical_WCV_interval(table_.getZTHR(),table_.getTCOA(),B,T,sz,vz);
+}
 
+LossData WCV_tvar::horizontalIntervalWithin(const Interval& ii, const Vect2& s2, const Vect2& vo2, const Vect2& vi2, double B, double T) const {
+  Vect2 v2 = vo2.Sub(vi2);
+  double time_in = T;
+  double time_out = B;
   if (ii.low > ii.up) {
     return LossData(time_in,time_out);
   }
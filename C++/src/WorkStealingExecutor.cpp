@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2011-2021 United States Government as represented by
+ * the National Aeronautics and Space Administration.  No copyright
+ * is claimed in the United States under Title 17, U.S.Code. All Other
+ * Rights Reserved.
+ */
+#include "WorkStealingExecutor.h"
+#include "Util.h"
+#include <utility>
+
+namespace larcfm {
+
+thread_local WorkStealingExecutor* WorkStealingExecutor::current_executor_ = NULL;
+thread_local int WorkStealingExecutor::current_queue_ = -1;
+
+WorkStealingExecutor::WorkStealingExecutor(int threads) : queued_(0), next_queue_(0), stop_(false) {
+  threads = Util::max(1,threads);
+  for (int k = 0; k < threads; ++k) {
+    queues_.push_back(std::unique_ptr<Queue>(new Queue()));
+  }
+  for (int k = 0; k < threads; ++k) {
+    threads_.push_back(std::thread(&WorkStealingExecutor::worker,this,k));
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+  {
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    stop_ = true;
+  }
+  idle_.notify_all();
+  for (std::vector<std::thread>::iterator thread = threads_.begin(); thread != threads_.end(); ++thread) {
+    thread->join();
+  }
+}
+
+void WorkStealingExecutor::submit(TaskGroup& group, const std::function<void()>& task) {
+  group.add();
+  int idx = current_executor_ == this ? current_queue_ : (int)(next_queue_++ % queues_.size());
+  {
+    std::lock_guard<std::mutex> lock(queues_[idx]->mutex);
+    queues_[idx]->jobs.push_back(Job(task,&group));
+  }
+  {
+    // Increment under idle_mutex_, so that an idle thread doesn't miss the notification
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    ++queued_;
+  }
+  idle_.notify_one();
+}
+
+// Most recent job of the idx-th queue
+bool WorkStealingExecutor::pop(int idx, Job& job) {
+  std::lock_guard<std::mutex> lock(queues_[idx]->mutex);
+  if (queues_[idx]->jobs.empty()) {
+    return false;
+  }
+  job = std::move(queues_[idx]->jobs.back());
+  queues_[idx]->jobs.pop_back();
+  --queued_;
+  return true;
+}
+
+// Oldest job of a queue other than the idx-th one
+bool WorkStealingExecutor::steal(int idx, Job& job) {
+  int n = queues_.size();
+  for (int k = 1; k <= n; ++k) {
+    int victim = (idx+k) % n;
+    if (victim == idx) {
+      continue;
+    }
+    std::lock_guard<std::mutex> lock(queues_[victim]->mutex);
+    if (!queues_[victim]->jobs.empty()) {
+      job = std::move(queues_[victim]->jobs.front());
+      queues_[victim]->jobs.pop_front();
+      --queued_;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Any job, starting with the queue of the current thread
+bool WorkStealingExecutor::take(Job& job) {
+  if (current_executor_ == this) {
+    return pop(current_queue_,job) || steal(current_queue_,job);
+  }
+  return steal(-1,job);
+}
+
+void WorkStealingExecutor::run(Job& job) {
+  if (!job.group->isCancelled()) {
+    job.task();
+  }
+  job.group->done();
+}
+
+void WorkStealingExecutor::worker(int idx) {
+  current_executor_ = this;
+  current_queue_ = idx;
+  Job job;
+  for (;;) {
+    if (take(job)) {
+      run(job);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(idle_mutex_);
+    while (queued_ == 0 && !stop_) {
+      idle_.wait(lock);
+    }
+    if (queued_ == 0 && stop_) {
+      return;
+    }
+  }
+}
+
+void WorkStealingExecutor::wait(TaskGroup& group) {
+  Job job;
+  // Help with pending tasks, which may be the ones of group, until there is nothing left to take.
+  // The remaining tasks of group are then running in other threads.
+  while (group.pending() > 0 && take(job)) {
+    run(job);
+  }
+  group.wait_finished();
+}
+
+int WorkStealingExecutor::concurrency() const {
+  return threads_.size();
+}
+
+}